@@ -0,0 +1,87 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+
+#include "threadpool.h"
+#include "workstealingthreadpool.h"
+
+// 模拟provider的用法: 若干IO线程不断提交很小的任务，统计全部执行完的耗时
+// 用法: ./threadpool_benchmark [IO线程数] [每个IO线程提交的任务数]
+static double runBenchmark(Executor &pool, int producer_num, int tasks_per_producer)
+{
+    std::atomic_long remaining((long)producer_num * tasks_per_producer);
+    std::atomic_long sink(0);
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_num; ++p) {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < tasks_per_producer; ++i) {
+                pool.post([&, i]() {
+                    // 一点点计算，模拟很轻的业务方法
+                    long x = i;
+                    for (int k = 0; k < 64; ++k) {
+                        x = x * 31 + k;
+                    }
+                    sink += x & 1;
+                    if (--remaining == 0) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done = true;
+                        cv.notify_one();
+                    }
+                });
+            }
+        });
+    }
+    for (auto &th : producers) {
+        th.join();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&done]() { return done; });
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end_time - start_time;
+    return elapsed.count();
+}
+
+int main(int argc, char **argv)
+{
+    int producer_num = argc > 1 ? std::stoi(argv[1]) : 4;
+    int tasks_per_producer = argc > 2 ? std::stoi(argv[2]) : 500000;
+    long total = (long)producer_num * tasks_per_producer;
+
+    std::cout << "===========================================" << std::endl;
+    std::cout << "ThreadPool benchmark" << std::endl;
+    std::cout << "Producer threads: " << producer_num << std::endl;
+    std::cout << "Total tasks: " << total << std::endl;
+    std::cout << "===========================================" << std::endl;
+
+    for (int workers : {2, 4, 8, 16, 32}) {
+        double simple_time;
+        double stealing_time;
+        {
+            ThreadPool pool(workers);
+            simple_time = runBenchmark(pool, producer_num, tasks_per_producer);
+        }
+        {
+            WorkStealingThreadPool pool(workers);
+            stealing_time = runBenchmark(pool, producer_num, tasks_per_producer);
+        }
+        std::cout << "workers: " << workers
+                  << "  ThreadPool: " << (long)(total / simple_time) << " tasks/s"
+                  << "  WorkStealingThreadPool: " << (long)(total / stealing_time) << " tasks/s"
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <iostream>
+#include <vector>
+
+#include "mpzrpcapplication.h"
+#include "example.service.pb.h"
+#include "mpzrpcchannel.h"
+#include "mpzrpcfuture.h"
+
+int main(int argc, char **argv)
+{
+    // 1. 初始化框架
+    MpzrpcApplication::init(argc, argv);
+
+    // 2. 创建一个 Stub 实例
+    example::UserRpcService_Stub stub(new MpzrpcChannel());
+
+    // 3. 并发发起多个调用，总耗时取决于最慢的一个，而不是所有调用之和
+    std::vector<MpzrpcFuture<example::LoginResponse>> futures;
+    for (int i = 0; i < 5; ++i)
+    {
+        example::LoginRequest request;
+        request.set_name("user" + std::to_string(i));
+        request.set_pwd("123");
+        futures.push_back(mpzrpcCall(stub, &example::UserRpcService_Stub::Login, request));
+    }
+
+    // 4. 用then对单个结果做后续处理，回调在客户端IO线程中执行
+    MpzrpcFuture<bool> first_success = futures[0].then([](MpzrpcFuture<example::LoginResponse> &f) {
+        return !f.failed() && f.get().success();
+    });
+
+    // 5. 等待全部完成
+    mpzrpcWhenAll(futures).wait();
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        if (futures[i].failed())
+        {
+            std::cout << "RPC call " << i << " failed: " << futures[i].errorText() << std::endl;
+        }
+        else
+        {
+            std::cout << "RPC call " << i << " login success: " << futures[i].get().success() << std::endl;
+        }
+    }
+    std::cout << "first call success: " << first_success.get() << std::endl;
+
+    return 0;
+}
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -161,9 +161,11 @@ class ResultCode final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResultCode& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ResultCode& from);
+  void MergeFrom( const ResultCode& from) {
+    ResultCode::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -172,10 +174,10 @@ class ResultCode final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResultCode* other);
@@ -233,9 +235,12 @@ class ResultCode final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
-  int32_t errcode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
+    int32_t errcode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -320,9 +325,11 @@ class LoginRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const LoginRequest& from);
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -331,10 +338,10 @@ class LoginRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRequest* other);
@@ -397,9 +404,12 @@ class LoginRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -484,9 +494,11 @@ class LoginResponse final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const LoginResponse& from);
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -495,10 +507,10 @@ class LoginResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginResponse* other);
@@ -560,9 +572,12 @@ class LoginResponse final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::example::ResultCode* result_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::example::ResultCode* result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -647,9 +662,11 @@ class RegisterRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RegisterRequest& from);
+  void MergeFrom( const RegisterRequest& from) {
+    RegisterRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -658,10 +675,10 @@ class RegisterRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterRequest* other);
@@ -734,10 +751,13 @@ class RegisterRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
-  uint32_t id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -822,9 +842,11 @@ class RegisterResponse final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RegisterResponse& from);
+  void MergeFrom( const RegisterResponse& from) {
+    RegisterResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -833,10 +855,10 @@ class RegisterResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterResponse* other);
@@ -898,9 +920,12 @@ class RegisterResponse final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::example::ResultCode* result_;
-  bool sucess_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::example::ResultCode* result_;
+    bool sucess_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -985,9 +1010,11 @@ class GetFriendsListRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendsListRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const GetFriendsListRequest& from);
+  void MergeFrom( const GetFriendsListRequest& from) {
+    GetFriendsListRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -996,10 +1023,10 @@ class GetFriendsListRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendsListRequest* other);
@@ -1042,8 +1069,11 @@ class GetFriendsListRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  uint32_t userid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t userid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1128,9 +1158,11 @@ class GetFriendsListResponse final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendsListResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const GetFriendsListResponse& from);
+  void MergeFrom( const GetFriendsListResponse& from) {
+    GetFriendsListResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1139,10 +1171,10 @@ class GetFriendsListResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendsListResponse* other);
@@ -1219,9 +1251,12 @@ class GetFriendsListResponse final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> friends_;
-  ::example::ResultCode* result_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> friends_;
+    ::example::ResultCode* result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_example_2eservice_2eproto;
 };
 // ===================================================================
@@ -1363,10 +1398,10 @@ class FiendRpcService_Stub : public FiendRpcService {
 
 // int32 errcode = 1;
 inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
+  _impl_.errcode_ = 0;
 }
 inline int32_t ResultCode::_internal_errcode() const {
-  return errcode_;
+  return _impl_.errcode_;
 }
 inline int32_t ResultCode::errcode() const {
   // @@protoc_insertion_point(field_get:example.ResultCode.errcode)
@@ -1374,7 +1409,7 @@ inline int32_t ResultCode::errcode() const {
 }
 inline void ResultCode::_internal_set_errcode(int32_t value) {
   
-  errcode_ = value;
+  _impl_.errcode_ = value;
 }
 inline void ResultCode::set_errcode(int32_t value) {
   _internal_set_errcode(value);
@@ -1383,7 +1418,7 @@ inline void ResultCode::set_errcode(int32_t value) {
 
 // bytes errmsg = 2;
 inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmpty();
+  _impl_.errmsg_.ClearToEmpty();
 }
 inline const std::string& ResultCode::errmsg() const {
   // @@protoc_insertion_point(field_get:example.ResultCode.errmsg)
@@ -1393,7 +1428,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ResultCode::set_errmsg(ArgT0&& arg0, ArgT... args) {
  
- errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:example.ResultCode.errmsg)
 }
 inline std::string* ResultCode::mutable_errmsg() {
@@ -1402,19 +1437,19 @@ inline std::string* ResultCode::mutable_errmsg() {
   return _s;
 }
 inline const std::string& ResultCode::_internal_errmsg() const {
-  return errmsg_.Get();
+  return _impl_.errmsg_.Get();
 }
 inline void ResultCode::_internal_set_errmsg(const std::string& value) {
   
-  errmsg_.Set(value, GetArenaForAllocation());
+  _impl_.errmsg_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ResultCode::_internal_mutable_errmsg() {
   
-  return errmsg_.Mutable(GetArenaForAllocation());
+  return _impl_.errmsg_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ResultCode::release_errmsg() {
   // @@protoc_insertion_point(field_release:example.ResultCode.errmsg)
-  return errmsg_.Release();
+  return _impl_.errmsg_.Release();
 }
 inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   if (errmsg != nullptr) {
@@ -1422,10 +1457,10 @@ inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
   } else {
     
   }
-  errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
+  _impl_.errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (errmsg_.IsDefault()) {
-    errmsg_.Set("", GetArenaForAllocation());
+  if (_impl_.errmsg_.IsDefault()) {
+    _impl_.errmsg_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:example.ResultCode.errmsg)
@@ -1437,7 +1472,7 @@ inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
 
 // bytes name = 1;
 inline void LoginRequest::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& LoginRequest::name() const {
   // @@protoc_insertion_point(field_get:example.LoginRequest.name)
@@ -1447,7 +1482,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void LoginRequest::set_name(ArgT0&& arg0, ArgT... args) {
  
- name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:example.LoginRequest.name)
 }
 inline std::string* LoginRequest::mutable_name() {
@@ -1456,19 +1491,19 @@ inline std::string* LoginRequest::mutable_name() {
   return _s;
 }
 inline const std::string& LoginRequest::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void LoginRequest::_internal_set_name(const std::string& value) {
   
-  name_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LoginRequest::_internal_mutable_name() {
   
-  return name_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LoginRequest::release_name() {
   // @@protoc_insertion_point(field_release:example.LoginRequest.name)
-  return name_.Release();
+  return _impl_.name_.Release();
 }
 inline void LoginRequest::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1476,10 +1511,10 @@ inline void LoginRequest::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (name_.IsDefault()) {
-    name_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:example.LoginRequest.name)
@@ -1487,7 +1522,7 @@ inline void LoginRequest::set_allocated_name(std::string* name) {
 
 // bytes pwd = 2;
 inline void LoginRequest::clear_pwd() {
-  pwd_.ClearToEmpty();
+  _impl_.pwd_.ClearToEmpty();
 }
 inline const std::string& LoginRequest::pwd() const {
   // @@protoc_insertion_point(field_get:example.LoginRequest.pwd)
@@ -1497,7 +1532,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void LoginRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
  
- pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:example.LoginRequest.pwd)
 }
 inline std::string* LoginRequest::mutable_pwd() {
@@ -1506,19 +1541,19 @@ inline std::string* LoginRequest::mutable_pwd() {
   return _s;
 }
 inline const std::string& LoginRequest::_internal_pwd() const {
-  return pwd_.Get();
+  return _impl_.pwd_.Get();
 }
 inline void LoginRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.Set(value, GetArenaForAllocation());
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LoginRequest::_internal_mutable_pwd() {
   
-  return pwd_.Mutable(GetArenaForAllocation());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LoginRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:example.LoginRequest.pwd)
-  return pwd_.Release();
+  return _impl_.pwd_.Release();
 }
 inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
   if (pwd != nullptr) {
@@ -1526,10 +1561,10 @@ inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
   } else {
     
   }
-  pwd_.SetAllocated(pwd, GetArenaForAllocation());
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (pwd_.IsDefault()) {
-    pwd_.Set("", GetArenaForAllocation());
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:example.LoginRequest.pwd)
@@ -1541,19 +1576,19 @@ inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
 
 // .example.ResultCode result = 1;
 inline bool LoginResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool LoginResponse::has_result() const {
   return _internal_has_result();
 }
 inline void LoginResponse::clear_result() {
-  if (GetArenaForAllocation() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::example::ResultCode& LoginResponse::_internal_result() const {
-  const ::example::ResultCode* p = result_;
+  const ::example::ResultCode* p = _impl_.result_;
   return p != nullptr ? *p : reinterpret_cast<const ::example::ResultCode&>(
       ::example::_ResultCode_default_instance_);
 }
@@ -1564,9 +1599,9 @@ inline const ::example::ResultCode& LoginResponse::result() const {
 inline void LoginResponse::unsafe_arena_set_allocated_result(
     ::example::ResultCode* result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -1576,8 +1611,8 @@ inline void LoginResponse::unsafe_arena_set_allocated_result(
 }
 inline ::example::ResultCode* LoginResponse::release_result() {
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1592,17 +1627,17 @@ inline ::example::ResultCode* LoginResponse::release_result() {
 inline ::example::ResultCode* LoginResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:example.LoginResponse.result)
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::example::ResultCode* LoginResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
+  if (_impl_.result_ == nullptr) {
     auto* p = CreateMaybeMessage<::example::ResultCode>(GetArenaForAllocation());
-    result_ = p;
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::example::ResultCode* LoginResponse::mutable_result() {
   ::example::ResultCode* _msg = _internal_mutable_result();
@@ -1612,7 +1647,7 @@ inline ::example::ResultCode* LoginResponse::mutable_result() {
 inline void LoginResponse::set_allocated_result(::example::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -1625,16 +1660,16 @@ inline void LoginResponse::set_allocated_result(::example::ResultCode* result) {
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:example.LoginResponse.result)
 }
 
 // bool success = 2;
 inline void LoginResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool LoginResponse::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool LoginResponse::success() const {
   // @@protoc_insertion_point(field_get:example.LoginResponse.success)
@@ -1642,7 +1677,7 @@ inline bool LoginResponse::success() const {
 }
 inline void LoginResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void LoginResponse::set_success(bool value) {
   _internal_set_success(value);
@@ -1655,10 +1690,10 @@ inline void LoginResponse::set_success(bool value) {
 
 // uint32 id = 1;
 inline void RegisterRequest::clear_id() {
-  id_ = 0u;
+  _impl_.id_ = 0u;
 }
 inline uint32_t RegisterRequest::_internal_id() const {
-  return id_;
+  return _impl_.id_;
 }
 inline uint32_t RegisterRequest::id() const {
   // @@protoc_insertion_point(field_get:example.RegisterRequest.id)
@@ -1666,7 +1701,7 @@ inline uint32_t RegisterRequest::id() const {
 }
 inline void RegisterRequest::_internal_set_id(uint32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
 }
 inline void RegisterRequest::set_id(uint32_t value) {
   _internal_set_id(value);
@@ -1675,7 +1710,7 @@ inline void RegisterRequest::set_id(uint32_t value) {
 
 // bytes name = 2;
 inline void RegisterRequest::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& RegisterRequest::name() const {
   // @@protoc_insertion_point(field_get:example.RegisterRequest.name)
@@ -1685,7 +1720,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void RegisterRequest::set_name(ArgT0&& arg0, ArgT... args) {
  
- name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:example.RegisterRequest.name)
 }
 inline std::string* RegisterRequest::mutable_name() {
@@ -1694,19 +1729,19 @@ inline std::string* RegisterRequest::mutable_name() {
   return _s;
 }
 inline const std::string& RegisterRequest::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void RegisterRequest::_internal_set_name(const std::string& value) {
   
-  name_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::_internal_mutable_name() {
   
-  return name_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::release_name() {
   // @@protoc_insertion_point(field_release:example.RegisterRequest.name)
-  return name_.Release();
+  return _impl_.name_.Release();
 }
 inline void RegisterRequest::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1714,10 +1749,10 @@ inline void RegisterRequest::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (name_.IsDefault()) {
-    name_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:example.RegisterRequest.name)
@@ -1725,7 +1760,7 @@ inline void RegisterRequest::set_allocated_name(std::string* name) {
 
 // bytes pwd = 3;
 inline void RegisterRequest::clear_pwd() {
-  pwd_.ClearToEmpty();
+  _impl_.pwd_.ClearToEmpty();
 }
 inline const std::string& RegisterRequest::pwd() const {
   // @@protoc_insertion_point(field_get:example.RegisterRequest.pwd)
@@ -1735,7 +1770,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void RegisterRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
  
- pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:example.RegisterRequest.pwd)
 }
 inline std::string* RegisterRequest::mutable_pwd() {
@@ -1744,19 +1779,19 @@ inline std::string* RegisterRequest::mutable_pwd() {
   return _s;
 }
 inline const std::string& RegisterRequest::_internal_pwd() const {
-  return pwd_.Get();
+  return _impl_.pwd_.Get();
 }
 inline void RegisterRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.Set(value, GetArenaForAllocation());
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::_internal_mutable_pwd() {
   
-  return pwd_.Mutable(GetArenaForAllocation());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RegisterRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:example.RegisterRequest.pwd)
-  return pwd_.Release();
+  return _impl_.pwd_.Release();
 }
 inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
   if (pwd != nullptr) {
@@ -1764,10 +1799,10 @@ inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
   } else {
     
   }
-  pwd_.SetAllocated(pwd, GetArenaForAllocation());
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (pwd_.IsDefault()) {
-    pwd_.Set("", GetArenaForAllocation());
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:example.RegisterRequest.pwd)
@@ -1779,19 +1814,19 @@ inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
 
 // .example.ResultCode result = 1;
 inline bool RegisterResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool RegisterResponse::has_result() const {
   return _internal_has_result();
 }
 inline void RegisterResponse::clear_result() {
-  if (GetArenaForAllocation() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::example::ResultCode& RegisterResponse::_internal_result() const {
-  const ::example::ResultCode* p = result_;
+  const ::example::ResultCode* p = _impl_.result_;
   return p != nullptr ? *p : reinterpret_cast<const ::example::ResultCode&>(
       ::example::_ResultCode_default_instance_);
 }
@@ -1802,9 +1837,9 @@ inline const ::example::ResultCode& RegisterResponse::result() const {
 inline void RegisterResponse::unsafe_arena_set_allocated_result(
     ::example::ResultCode* result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -1814,8 +1849,8 @@ inline void RegisterResponse::unsafe_arena_set_allocated_result(
 }
 inline ::example::ResultCode* RegisterResponse::release_result() {
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1830,17 +1865,17 @@ inline ::example::ResultCode* RegisterResponse::release_result() {
 inline ::example::ResultCode* RegisterResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:example.RegisterResponse.result)
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::example::ResultCode* RegisterResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
+  if (_impl_.result_ == nullptr) {
     auto* p = CreateMaybeMessage<::example::ResultCode>(GetArenaForAllocation());
-    result_ = p;
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::example::ResultCode* RegisterResponse::mutable_result() {
   ::example::ResultCode* _msg = _internal_mutable_result();
@@ -1850,7 +1885,7 @@ inline ::example::ResultCode* RegisterResponse::mutable_result() {
 inline void RegisterResponse::set_allocated_result(::example::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -1863,16 +1898,16 @@ inline void RegisterResponse::set_allocated_result(::example::ResultCode* result
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:example.RegisterResponse.result)
 }
 
 // bool sucess = 2;
 inline void RegisterResponse::clear_sucess() {
-  sucess_ = false;
+  _impl_.sucess_ = false;
 }
 inline bool RegisterResponse::_internal_sucess() const {
-  return sucess_;
+  return _impl_.sucess_;
 }
 inline bool RegisterResponse::sucess() const {
   // @@protoc_insertion_point(field_get:example.RegisterResponse.sucess)
@@ -1880,7 +1915,7 @@ inline bool RegisterResponse::sucess() const {
 }
 inline void RegisterResponse::_internal_set_sucess(bool value) {
   
-  sucess_ = value;
+  _impl_.sucess_ = value;
 }
 inline void RegisterResponse::set_sucess(bool value) {
   _internal_set_sucess(value);
@@ -1893,10 +1928,10 @@ inline void RegisterResponse::set_sucess(bool value) {
 
 // uint32 userid = 1;
 inline void GetFriendsListRequest::clear_userid() {
-  userid_ = 0u;
+  _impl_.userid_ = 0u;
 }
 inline uint32_t GetFriendsListRequest::_internal_userid() const {
-  return userid_;
+  return _impl_.userid_;
 }
 inline uint32_t GetFriendsListRequest::userid() const {
   // @@protoc_insertion_point(field_get:example.GetFriendsListRequest.userid)
@@ -1904,7 +1939,7 @@ inline uint32_t GetFriendsListRequest::userid() const {
 }
 inline void GetFriendsListRequest::_internal_set_userid(uint32_t value) {
   
-  userid_ = value;
+  _impl_.userid_ = value;
 }
 inline void GetFriendsListRequest::set_userid(uint32_t value) {
   _internal_set_userid(value);
@@ -1917,19 +1952,19 @@ inline void GetFriendsListRequest::set_userid(uint32_t value) {
 
 // .example.ResultCode result = 1;
 inline bool GetFriendsListResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
 }
 inline bool GetFriendsListResponse::has_result() const {
   return _internal_has_result();
 }
 inline void GetFriendsListResponse::clear_result() {
-  if (GetArenaForAllocation() == nullptr && result_ != nullptr) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = nullptr;
+  _impl_.result_ = nullptr;
 }
 inline const ::example::ResultCode& GetFriendsListResponse::_internal_result() const {
-  const ::example::ResultCode* p = result_;
+  const ::example::ResultCode* p = _impl_.result_;
   return p != nullptr ? *p : reinterpret_cast<const ::example::ResultCode&>(
       ::example::_ResultCode_default_instance_);
 }
@@ -1940,9 +1975,9 @@ inline const ::example::ResultCode& GetFriendsListResponse::result() const {
 inline void GetFriendsListResponse::unsafe_arena_set_allocated_result(
     ::example::ResultCode* result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
   }
-  result_ = result;
+  _impl_.result_ = result;
   if (result) {
     
   } else {
@@ -1952,8 +1987,8 @@ inline void GetFriendsListResponse::unsafe_arena_set_allocated_result(
 }
 inline ::example::ResultCode* GetFriendsListResponse::release_result() {
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1968,17 +2003,17 @@ inline ::example::ResultCode* GetFriendsListResponse::release_result() {
 inline ::example::ResultCode* GetFriendsListResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:example.GetFriendsListResponse.result)
   
-  ::example::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::example::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
 inline ::example::ResultCode* GetFriendsListResponse::_internal_mutable_result() {
   
-  if (result_ == nullptr) {
+  if (_impl_.result_ == nullptr) {
     auto* p = CreateMaybeMessage<::example::ResultCode>(GetArenaForAllocation());
-    result_ = p;
+    _impl_.result_ = p;
   }
-  return result_;
+  return _impl_.result_;
 }
 inline ::example::ResultCode* GetFriendsListResponse::mutable_result() {
   ::example::ResultCode* _msg = _internal_mutable_result();
@@ -1988,7 +2023,7 @@ inline ::example::ResultCode* GetFriendsListResponse::mutable_result() {
 inline void GetFriendsListResponse::set_allocated_result(::example::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete result_;
+    delete _impl_.result_;
   }
   if (result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -2001,19 +2036,19 @@ inline void GetFriendsListResponse::set_allocated_result(::example::ResultCode*
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:example.GetFriendsListResponse.result)
 }
 
 // repeated bytes friends = 2;
 inline int GetFriendsListResponse::_internal_friends_size() const {
-  return friends_.size();
+  return _impl_.friends_.size();
 }
 inline int GetFriendsListResponse::friends_size() const {
   return _internal_friends_size();
 }
 inline void GetFriendsListResponse::clear_friends() {
-  friends_.Clear();
+  _impl_.friends_.Clear();
 }
 inline std::string* GetFriendsListResponse::add_friends() {
   std::string* _s = _internal_add_friends();
@@ -2021,7 +2056,7 @@ inline std::string* GetFriendsListResponse::add_friends() {
   return _s;
 }
 inline const std::string& GetFriendsListResponse::_internal_friends(int index) const {
-  return friends_.Get(index);
+  return _impl_.friends_.Get(index);
 }
 inline const std::string& GetFriendsListResponse::friends(int index) const {
   // @@protoc_insertion_point(field_get:example.GetFriendsListResponse.friends)
@@ -2029,55 +2064,55 @@ inline const std::string& GetFriendsListResponse::friends(int index) const {
 }
 inline std::string* GetFriendsListResponse::mutable_friends(int index) {
   // @@protoc_insertion_point(field_mutable:example.GetFriendsListResponse.friends)
-  return friends_.Mutable(index);
+  return _impl_.friends_.Mutable(index);
 }
 inline void GetFriendsListResponse::set_friends(int index, const std::string& value) {
-  friends_.Mutable(index)->assign(value);
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::set_friends(int index, std::string&& value) {
-  friends_.Mutable(index)->assign(std::move(value));
+  _impl_.friends_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::set_friends(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  friends_.Mutable(index)->assign(value);
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::set_friends(int index, const void* value, size_t size) {
-  friends_.Mutable(index)->assign(
+  _impl_.friends_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:example.GetFriendsListResponse.friends)
 }
 inline std::string* GetFriendsListResponse::_internal_add_friends() {
-  return friends_.Add();
+  return _impl_.friends_.Add();
 }
 inline void GetFriendsListResponse::add_friends(const std::string& value) {
-  friends_.Add()->assign(value);
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(std::string&& value) {
-  friends_.Add(std::move(value));
+  _impl_.friends_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  friends_.Add()->assign(value);
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:example.GetFriendsListResponse.friends)
 }
 inline void GetFriendsListResponse::add_friends(const void* value, size_t size) {
-  friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:example.GetFriendsListResponse.friends)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 GetFriendsListResponse::friends() const {
   // @@protoc_insertion_point(field_list:example.GetFriendsListResponse.friends)
-  return friends_;
+  return _impl_.friends_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 GetFriendsListResponse::mutable_friends() {
   // @@protoc_insertion_point(field_mutable_list:example.GetFriendsListResponse.friends)
-  return &friends_;
+  return &_impl_.friends_;
 }
 
 #ifdef __GNUC__
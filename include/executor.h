@@ -0,0 +1,13 @@
+#pragma once
+
+#include "task.h"
+
+// 业务线程池的公共接口，MpzrpcProvider按配置选择具体实现
+class Executor
+{
+public:
+    virtual ~Executor() {}
+
+    // 提交不需要返回值的任务，可在任意线程调用
+    virtual void post(Task task) = 0;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+
+// 带初始块的Arena，调用结束Reset后初始块保留下来供下一次调用使用
+struct MpzrpcPooledArena
+{
+    // 大多数请求、响应和调用上下文都能放进初始块，不再向系统申请内存
+    static const size_t kInitialBlockSize = 4096;
+
+    char block[kInitialBlockSize];
+    google::protobuf::Arena arena;
+
+    MpzrpcPooledArena() : arena(block, sizeof(block)) {}
+};
+
+// 服务端每次调用从这里取一个Arena，请求、响应和调用上下文都分配在上面，
+// 响应发出后一次性释放并放回池中
+class MpzrpcArenaPool
+{
+public:
+    explicit MpzrpcArenaPool(size_t max_cached = 1024) : m_maxCached(max_cached) {}
+
+    ~MpzrpcArenaPool()
+    {
+        for (MpzrpcPooledArena *arena : m_freeArenas)
+        {
+            delete arena;
+        }
+    }
+
+    MpzrpcPooledArena *acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_freeArenas.empty())
+            {
+                MpzrpcPooledArena *arena = m_freeArenas.back();
+                m_freeArenas.pop_back();
+                return arena;
+            }
+        }
+        return new MpzrpcPooledArena();
+    }
+
+    // 析构Arena上创建的对象并释放初始块以外的内存，可在任意线程调用
+    void release(MpzrpcPooledArena *arena)
+    {
+        arena->arena.Reset();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_freeArenas.size() < m_maxCached)
+            {
+                m_freeArenas.push_back(arena);
+                return;
+            }
+        }
+        delete arena;
+    }
+
+private:
+    size_t m_maxCached;
+    std::vector<MpzrpcPooledArena *> m_freeArenas;
+    std::mutex m_mutex;
+};
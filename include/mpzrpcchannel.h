@@ -2,6 +2,10 @@
 #include <google/protobuf/service.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/message.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <mutex>
 
 class MpzrpcChannel : public google::protobuf::RpcChannel
 {
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+
+#include <google/protobuf/descriptor.h>
+#include <muduo/net/TcpConnection.h>
+#include <muduo/net/EventLoop.h>
+
+#include "rpcheader.pb.h"
+
+// 客户端的一条多路复用连接
+// 每个请求都带有request_id，多个调用可以同时在一条连接上等待，
+// 响应可以乱序返回，由IO线程按request_id分发给对应的调用
+class MpzrpcClientConnection : public std::enable_shared_from_this<MpzrpcClientConnection>
+{
+public:
+    // 收到响应或连接断开时在IO线程中回调
+    // ok为false表示连接已断开，此时header和data无意义
+    // data指向muduo输入缓冲区，只在回调期间有效
+    using ResponseCallback = std::function<void(bool ok, const rpcheader::rpcresponseheader &header, const char *data)>;
+
+    // sockfd必须是已经connect成功的套接字，由本对象接管并负责关闭
+    // 响应体超过max_response_size字节时视为数据错乱，关闭连接
+    MpzrpcClientConnection(muduo::net::EventLoop *loop, int sockfd, const std::string &host_key, uint32_t max_response_size);
+    ~MpzrpcClientConnection();
+
+    // 在IO线程中注册连接，开始收发数据
+    void start();
+
+    // 生成进程内唯一的请求id
+    static uint64_t newRequestId();
+
+    // 登记回调并发送一个请求帧，可在任意线程调用
+    // 帧被移动到IO线程后再写入，不会再拷贝一次
+    // 返回false表示连接已失效，回调不会被调用
+    bool sendRequest(uint64_t request_id, std::string &&frame, ResponseCallback cb);
+
+    // 发送一个不需要响应的帧，如取消帧
+    void sendFrame(std::string &&frame);
+
+    // 放弃等待某个请求(如调用超时)，之后到达的响应会被丢弃
+    void removePending(uint64_t request_id);
+
+    // 服务端为方法分配的编号只在这条连接对应的服务进程内有效，所以按连接缓存
+    // 返回0表示还不知道，需要按名字调用
+    uint32_t getMethodId(const google::protobuf::MethodDescriptor *method);
+    void setMethodId(const google::protobuf::MethodDescriptor *method, uint32_t method_id);
+
+    muduo::net::EventLoop *getLoop() const { return m_loop; }
+    bool isValid() const { return m_valid; }
+    const std::string &hostKey() const { return m_hostKey; }
+    size_t pendingCount() const { return m_pendingCount; }
+
+private:
+    void onConnection(const muduo::net::TcpConnectionPtr &conn);
+    void onMessage(const muduo::net::TcpConnectionPtr &conn,
+                   muduo::net::Buffer *buffer,
+                   muduo::Timestamp receiveTime);
+
+    // 连接断开，所有在途请求都以失败回调
+    void failAllPending();
+
+    // 响应头的合理上限，超过即视为数据错乱
+    static const uint32_t kMaxResponseHeaderSize = 64 * 1024;
+
+    muduo::net::EventLoop *m_loop;
+    muduo::net::TcpConnectionPtr m_conn;
+    std::string m_hostKey;
+    uint32_t m_maxResponseSize;
+    std::atomic_bool m_valid;
+
+    // 在途请求表: request_id -> 回调
+    std::unordered_map<uint64_t, ResponseCallback> m_pendingCalls;
+    std::atomic_size_t m_pendingCount;
+    std::mutex m_pendingMutex;
+
+    // 已协商的方法编号
+    std::unordered_map<const google::protobuf::MethodDescriptor *, uint32_t> m_methodIds;
+    std::mutex m_methodIdMutex;
+};
+
+using spConnection = std::shared_ptr<MpzrpcClientConnection>;
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+
+// 自适应并发限制，限制一个业务线程池中已接收但还没结束的请求数
+// 按请求耗时自动调整上限(gradient算法):
+// 以空载时的最小耗时为基准，耗时超过基准说明请求开始排队，按 基准/耗时 的比例收缩上限；
+// 耗时接近基准时上限每次增加约 sqrt(上限)，探测更高的吞吐
+// 启动时以第一个窗口的耗时作为基准，之后取各窗口耗时的最小值；
+// 每隔一段时间重新测量一次: 上限先降到最小值，排空积压的请求后测得的耗时即为新的基准
+// 最小值应不低于线程池平时就能消化的在途请求数(线程数加上正常的排队)，否则测量期间正常的请求也会被拒绝
+// 处理函数变慢或变快、机器负载变化时不需要重新调整线程数和队列长度
+class MpzrpcConcurrencyLimiter
+{
+public:
+    // 上限在[min_limit, max_limit]之间调整，从min_limit开始
+    // probe_interval_s为重新测量基准的平均间隔(秒)，实际间隔在其上下25%内随机，避免多个线程池或节点同时测量；
+    // 0表示只在启动时测量
+    MpzrpcConcurrencyLimiter(int min_limit, int max_limit, int probe_interval_s);
+
+    // 在途请求数未达到上限时占用一个名额并返回true，否则返回false
+    bool tryAcquire();
+
+    // 请求结束时归还名额，rtt_us为从接收到结束的耗时
+    // 没有真正执行的请求(被挤掉、被取消)sampled为false，不参与调整
+    void release(int64_t rtt_us, bool sampled);
+
+    int limit() const;
+    int inflight() const;
+
+private:
+    // 每个采样窗口结束时按窗口内的平均耗时调整上限
+    void update(int64_t rtt_us);
+
+    // 当前窗口需要的采样数，窗口长度随上限增长，每个窗口大致覆盖一轮在途请求
+    int windowSize() const;
+
+    // 按平均间隔加上随机抖动安排下一次测量基准的时间
+    void scheduleProbe();
+
+    // 重新测量基准的阶段
+    enum ProbeState
+    {
+        kProbeNone,         // 正常调整上限
+        kProbeDraining,     // 上限已降到最小值，等待之前接收的请求结束
+        kProbeMeasuring,    // 本窗口的平均耗时作为新的基准
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    // 每个窗口的采样数下限
+    static constexpr int kMinWindowSamples = 20;
+
+    const int m_minLimit;
+    const int m_maxLimit;
+    const std::chrono::milliseconds m_probeInterval;
+    mutable std::mutex m_mutex;
+    double m_limit;
+    int m_inflight = 0;
+
+    int64_t m_minRttUs = 0;     // 空载基准耗时
+    ProbeState m_probeState = kProbeMeasuring;
+    double m_probeSavedLimit;   // 测量基准前的上限，测量结束后恢复
+    Clock::time_point m_nextProbe;  // 下一次重新测量基准的时间
+    std::minstd_rand m_rng;
+
+    // 当前窗口的采样
+    int64_t m_windowRttSumUs = 0;
+    int m_windowSamples = 0;
+    int m_windowMaxInflight = 0;
+};
@@ -2,6 +2,14 @@
 
 #include <iostream>
 #include <string>
+#include <unordered_map>
+
+// 一个独立业务线程池的配置
+struct MpzrpcPoolConfig
+{
+    int threadNum;
+    int maxQueuedCalls; // 0表示不限制
+};
 
 class MpzrpcConfig
 {
@@ -18,6 +26,24 @@ public:
     const int &getPoolInitSize() const { return m_poolInitSize; };
     const int &getPoolMaxSize() const { return m_poolMaxSize; };
     const int &getPoolTimeout() const { return m_poolTimeout; };
+    const int &getPoolMaxPending() const { return m_poolMaxPending; };
+    const int &getClientThreadNum() const { return m_clientThreadNum; };
+    const std::string &getRpcHeaderFormat() const { return m_rpcHeaderFormat; };
+    const std::string &getBusinessThreadPool() const { return m_businessThreadPool; };
+    const int &getMaxQueuedCalls() const { return m_maxQueuedCalls; };
+    const int &getMaxQueueWaitMs() const { return m_maxQueueWaitMs; };
+    const std::string &getProviderMode() const { return m_providerMode; };
+    const std::unordered_map<std::string, MpzrpcPoolConfig> &getThreadPools() const { return m_threadPools; };
+    const std::unordered_map<std::string, std::string> &getMethodPools() const { return m_methodPools; };
+    const int &getSchedulerStatsInterval() const { return m_schedulerStatsInterval; };
+    const std::string &getRpcTenant() const { return m_rpcTenant; };
+    const int &getTenantQuantumUs() const { return m_tenantQuantumUs; };
+    const bool &getAdaptiveLimit() const { return m_adaptiveLimit; };
+    const int &getAdaptiveLimitMax() const { return m_adaptiveLimitMax; };
+    const int &getAdaptiveLimitMin() const { return m_adaptiveLimitMin; };
+    const int &getAdaptiveLimitProbeInterval() const { return m_adaptiveLimitProbeInterval; };
+    const int &getMaxRequestSize() const { return m_maxRequestSize; };
+    const int &getMaxResponseSize() const { return m_maxResponseSize; };
 
 private:
     std::string m_rpcserverip;
@@ -30,4 +56,22 @@ private:
     int m_poolInitSize;
     int m_poolMaxSize;
     int m_poolTimeout;
+    int m_poolMaxPending; // 单条连接上的在途请求数超过该值时才新建连接
+    int m_clientThreadNum; // 客户端IO线程数量
+    std::string m_rpcHeaderFormat; // 客户端请求帧头格式: "protobuf" 或 "fixed"
+    std::string m_businessThreadPool; // 业务线程池类型
+    int m_maxQueuedCalls; // 排队等待业务线程的请求数上限，超过后直接回复过载
+    int m_maxQueueWaitMs; // 请求排队超过该时间(毫秒)不再执行，直接回复过载
+    std::string m_providerMode; // 服务端运行模式
+    std::unordered_map<std::string, MpzrpcPoolConfig> m_threadPools; // 线程池名 -> 配置
+    std::unordered_map<std::string, std::string> m_methodPools; // "服务名[.方法名]" -> 线程池名
+    int m_schedulerStatsInterval; // 每隔多少秒把各优先级的排队数写入日志
+    std::string m_rpcTenant; // 客户端的调用方身份，随请求发给服务端
+    int m_tenantQuantumUs; // 服务端按调用方轮询调度时每轮的额度(微秒)
+    bool m_adaptiveLimit; // 是否按请求耗时自动限制业务线程池的在途请求数
+    int m_adaptiveLimitMax; // 自适应并发上限的最大值
+    int m_adaptiveLimitMin; // 自适应并发上限的最小值，0表示取线程数的两倍
+    int m_adaptiveLimitProbeInterval; // 重新测量基准的平均间隔(秒)，0表示只在启动时测量
+    int m_maxRequestSize; // 请求体长度上限(字节)
+    int m_maxResponseSize; // 响应体长度上限(字节)
 };
\ No newline at end of file
@@ -2,34 +2,37 @@
 
 #include <string>
 #include <vector>
-#include <queue>
 #include <mutex>
+#include <condition_variable>
 #include <memory>
 #include <unordered_map>
 #include <atomic>
-#include <condition_variable>
-#include <chrono>
 
-#include "mpzrpcapplication.h"
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThread.h>
 
-// 被智能指针管理的连接对象
-struct PooledConnection {
-    int sockfd;
-    bool is_valid; // 标志此连接是否仍然有效
-    std::string host_key; // 用于归还时查找对应的队列
-};
-
-using spConnection = std::shared_ptr<PooledConnection>;
+#include "mpzrpcapplication.h"
+#include "mpzrpcclientconnection.h"
+#include "threadpool.h"
 
-// 连接池，改为管理到不同主机的连接集合
+// 连接池，管理到不同主机的多路复用连接
+// 一条连接上可以同时有多个在途请求，只有当连接都比较繁忙时才会新建连接
 class MpzrpcConnectionPool
 {
 public:
     // 获取连接池单例对象
     static MpzrpcConnectionPool* getInstance();
 
-    // 根据 ip 和 port 获取一个连接
-    spConnection getConnection(std::string ip, unsigned short port);
+    // 根据 ip 和 port 获取一个连接，返回在途请求最少的有效连接
+    // allow_create为false时只在已有连接中选择，不会阻塞在connect上，没有可用连接时返回nullptr
+    // 建立连接时不持有连接池的锁，IO线程在这里最多只等待挑选连接的时间
+    spConnection getConnection(std::string ip, unsigned short port, bool allow_create = true);
+
+    // 当前线程是否为客户端IO线程，在这些线程中不能阻塞等待响应，也不能阻塞建立连接
+    bool isClientLoopThread() const;
+
+    // 在后台线程中执行可能阻塞的操作(建立连接、查询ZK)，避免占用客户端IO线程
+    void runBlocking(Task task);
 
 private:
     // 单例模式
@@ -38,23 +41,40 @@ private:
     MpzrpcConnectionPool(const MpzrpcConnectionPool&) = delete;
     MpzrpcConnectionPool& operator=(const MpzrpcConnectionPool&) = delete;
 
-    // 创建一个到指定主机的新连接
-    int createConnection(std::string ip, unsigned short port);
-
-    // 归还一个连接到它对应的池中
-    void returnConnection(const std::string& host, int sockfd);
+    // 创建一个到指定主机的新连接，连接超时时间为pooltimeout
+    spConnection createConnection(const std::string& ip, unsigned short port, const std::string& host_key);
 
     void loadConfig();
 
-    // 核心数据结构：一个map，管理到不同主机的连接队列
-    std::unordered_map<std::string, std::queue<int>> m_connectionMap;
-    // 每个主机已创建的连接数
-    std::unordered_map<std::string, std::atomic_int> m_connectionCountMap;
+    // 到一个主机的连接集合
+    struct HostConnections
+    {
+        std::vector<spConnection> conns;
+        bool creating = false;  // 有线程正在建立到该主机的连接，其他线程不再重复建立
+    };
+
+    // 核心数据结构：一个map，管理到不同主机的连接集合
+    // m_mapMutex只保护map本身，建立连接期间不持有
+    std::unordered_map<std::string, HostConnections> m_connectionMap;
     std::mutex m_mapMutex;
-    std::condition_variable m_cv;
+    std::condition_variable m_createdCond;  // 建立连接结束时通知等待的线程
+
+    // 轮询选择一个客户端IO线程的EventLoop，新建的连接固定在该线程上收发
+    muduo::net::EventLoop* getNextLoop();
+
+    // 客户端IO线程，负责连接的收包、响应分发和超时定时器
+    std::vector<std::unique_ptr<muduo::net::EventLoopThread>> m_loopThreads;
+    std::vector<muduo::net::EventLoop*> m_loops;
+    std::atomic_size_t m_nextLoop;
+
+    // 执行runBlocking提交的任务
+    ThreadPool m_blockingPool;
 
     // 配置参数
     int m_initSize;
     int m_maxSize;
+    int m_maxPending;
     int m_poolTimeout;
+    uint32_t m_maxResponseSize;
+    int m_clientThreadNum;
 };
@@ -1,7 +1,12 @@
 #pragma once
 #include <google/protobuf/service.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
 
+#include "rpcheader.pb.h"
+
 class MpzrpcController : public google::protobuf::RpcController
 {
 public:
@@ -11,12 +16,34 @@ public:
     std::string ErrorText() const;
     void SetFailed(const std::string &reason);
 
-    // 目前未实现具体的功能
+    // 取消正在进行的调用: 向服务端发送取消帧，调用立即以失败结束(done照常执行)
+    // 可在任意线程调用，调用尚未发出时取消，发出时直接失败
     void StartCancel();
     bool IsCanceled() const;
+    // callback恰好执行一次: 调用被取消时立即执行，没有被取消则在调用结束时执行
     void NotifyOnCancel(google::protobuf::Closure *callback);
 
+    // 由MpzrpcChannel在请求发出后设置，StartCancel时执行，已经取消则立即执行
+    void SetCancelHandler(std::function<void()> handler);
+
+    // 由MpzrpcChannel在调用结束、执行done之前调用: 移除取消处理函数，之后的StartCancel不再发送取消帧；
+    // 没有被取消时执行NotifyOnCancel登记的回调
+    void MarkFinished();
+
+    // 本次调用的优先级，随请求发给服务端，服务端繁忙时先执行优先级高的请求，默认PRIORITY_NORMAL
+    void SetPriority(rpcheader::Priority priority);
+    rpcheader::Priority Priority() const;
+
 private:
     bool m_failed;         // RPC方法执行过程中的状态
     std::string m_errText; // RPC方法执行过程中的错误信息
-};
\ No newline at end of file
+
+    // StartCancel可能来自发起调用以外的线程
+    std::atomic_bool m_canceled;
+    bool m_finished;       // 调用已经结束，由m_cancelMutex保护
+    std::mutex m_cancelMutex;
+    std::function<void()> m_cancelHandler;
+    google::protobuf::Closure *m_cancelCallback;
+
+    rpcheader::Priority m_priority;
+};
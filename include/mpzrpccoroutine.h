@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+
+#include "mpzrpcfuture.h"
+
+// 协程恢复执行的调度器
+using MpzrpcResumeExecutor = std::function<void(std::function<void()>)>;
+
+// 当前线程的恢复调度器，MpzrpcProvider在业务线程中设置为投递回业务线程池，
+// 为空时协程在完成RPC的线程(客户端IO线程)中直接恢复
+inline MpzrpcResumeExecutor *&mpzrpcCurrentResumeExecutor()
+{
+    thread_local MpzrpcResumeExecutor *executor = nullptr;
+    return executor;
+}
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+#include <coroutine>
+#define MPZRPC_HAS_COROUTINE 1
+
+// 立即开始执行、结束后自行销毁的协程，用来编写co_await下游RPC的处理函数
+// 用法:
+//   void Login(controller, request, response, done) override { LoginAsync(controller, request, response, done); }
+//   MpzrpcTask LoginAsync(...) { auto f = co_await mpzrpcCall(stub, &Stub::Check, req); ...; done->Run(); }
+// 处理函数在第一个co_await处返回，业务线程随即被释放，RPC完成后再回到业务线程池继续执行
+struct MpzrpcTask
+{
+    struct promise_type
+    {
+        MpzrpcTask get_return_object() { return MpzrpcTask(); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// co_await一个future，挂起直到其完成，恢复后得到已经完成的future
+template <typename T>
+auto operator co_await(MpzrpcFuture<T> future)
+{
+    struct Awaiter
+    {
+        MpzrpcFuture<T> future;
+
+        bool await_ready() const { return future.isReady(); }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            MpzrpcResumeExecutor *executor = mpzrpcCurrentResumeExecutor();
+            // 回调与await_suspend谁后到达谁负责继续执行，避免在await_suspend返回前就恢复协程
+            auto arrived = std::make_shared<std::atomic_bool>(false);
+            future.then([handle, executor, arrived](MpzrpcFuture<T> &) {
+                if (!arrived->exchange(true))
+                {
+                    return;
+                }
+                if (executor != nullptr)
+                {
+                    (*executor)([handle]() { handle.resume(); });
+                }
+                else
+                {
+                    handle.resume();
+                }
+            });
+            return !arrived->exchange(true);
+        }
+
+        MpzrpcFuture<T> await_resume() { return future; }
+    };
+    return Awaiter{std::move(future)};
+}
+#endif
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include <utility>
+
+#include <google/protobuf/service.h>
+
+#include "mpzrpccontroller.h"
+
+template <typename T>
+class MpzrpcFuture;
+
+namespace mpzrpc_detail
+{
+// void结果用空结构体占位，让所有future共用一套共享状态
+struct Unit
+{
+};
+
+template <typename T>
+struct ValueType
+{
+    using type = T;
+};
+
+template <>
+struct ValueType<void>
+{
+    using type = Unit;
+};
+
+// future和promise之间的共享状态
+template <typename T>
+struct FutureState
+{
+    using Value = typename ValueType<T>::type;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool ready = false;
+    bool failed = false;
+    std::string errText;
+    Value value;
+    std::vector<std::function<void()>> callbacks;
+
+    // 标记完成并执行已注册的回调，只能调用一次
+    void finish(bool is_failed, std::string err)
+    {
+        std::vector<std::function<void()>> cbs;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready = true;
+            failed = is_failed;
+            errText = std::move(err);
+            cbs.swap(callbacks);
+        }
+        cv.notify_all();
+        for (auto &cb : cbs)
+        {
+            cb();
+        }
+    }
+
+    // 未完成时登记回调，已完成则在当前线程立即执行
+    void addCallback(std::function<void()> cb)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!ready)
+            {
+                callbacks.push_back(std::move(cb));
+                return;
+            }
+        }
+        cb();
+    }
+};
+
+template <typename T>
+struct IsFuture : std::false_type
+{
+};
+
+template <typename T>
+struct IsFuture<MpzrpcFuture<T>> : std::true_type
+{
+};
+
+template <typename U>
+struct ThenResult
+{
+    using type = MpzrpcFuture<U>;
+};
+
+// then的回调返回future时自动展开，避免出现future<future<T>>
+template <typename U>
+struct ThenResult<MpzrpcFuture<U>>
+{
+    using type = MpzrpcFuture<U>;
+};
+} // namespace mpzrpc_detail
+
+template <typename T>
+class MpzrpcPromise;
+
+// 异步调用结果的句柄，可以阻塞等待，也可以用then注册后续处理
+// 回调在完成结果的线程中执行，对RPC调用来说就是客户端IO线程，回调里不要做耗时操作
+template <typename T>
+class MpzrpcFuture
+{
+public:
+    using State = mpzrpc_detail::FutureState<T>;
+    using Value = typename State::Value;
+
+    MpzrpcFuture() {}
+    explicit MpzrpcFuture(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+    bool valid() const { return m_state != nullptr; }
+
+    bool isReady() const
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        return m_state->ready;
+    }
+
+    void wait() const
+    {
+        std::unique_lock<std::mutex> lock(m_state->mutex);
+        m_state->cv.wait(lock, [this]() { return m_state->ready; });
+    }
+
+    bool failed() const
+    {
+        wait();
+        return m_state->failed;
+    }
+
+    std::string errorText() const
+    {
+        wait();
+        return m_state->errText;
+    }
+
+    // 等待完成并返回结果，失败时为默认值
+    Value &get()
+    {
+        wait();
+        return m_state->value;
+    }
+
+    // 完成后以本future为参数调用f，返回代表f结果的新future
+    // 失败同样会触发f，由f自己检查failed()
+    template <typename F>
+    auto then(F &&f) -> typename mpzrpc_detail::ThenResult<typename std::invoke_result<F, MpzrpcFuture<T> &>::type>::type
+    {
+        using U = typename std::invoke_result<F, MpzrpcFuture<T> &>::type;
+        using Next = typename mpzrpc_detail::ThenResult<U>::type;
+
+        auto next = std::make_shared<typename Next::State>();
+        std::shared_ptr<State> state = m_state;
+        m_state->addCallback([state, next, f = std::forward<F>(f)]() mutable {
+            MpzrpcFuture<T> self(state);
+            if constexpr (std::is_void<U>::value)
+            {
+                f(self);
+                next->finish(false, "");
+            }
+            else if constexpr (mpzrpc_detail::IsFuture<U>::value)
+            {
+                U inner = f(self);
+                auto inner_state = inner.m_state;
+                inner_state->addCallback([inner_state, next]() {
+                    next->value = std::move(inner_state->value);
+                    next->finish(inner_state->failed, inner_state->errText);
+                });
+            }
+            else
+            {
+                next->value = f(self);
+                next->finish(false, "");
+            }
+        });
+        return Next(next);
+    }
+
+private:
+    template <typename>
+    friend class MpzrpcFuture;
+
+    std::shared_ptr<State> m_state;
+};
+
+// 结果的生产方，每个promise只能完成一次
+template <typename T>
+class MpzrpcPromise
+{
+public:
+    using State = mpzrpc_detail::FutureState<T>;
+    using Value = typename State::Value;
+
+    MpzrpcPromise() : m_state(std::make_shared<State>()) {}
+
+    MpzrpcFuture<T> getFuture() const { return MpzrpcFuture<T>(m_state); }
+
+    // 结果可以先原地填充，再调用无参的setValue完成
+    Value *valuePtr() { return &m_state->value; }
+
+    void setValue() { m_state->finish(false, ""); }
+
+    void setValue(Value value)
+    {
+        m_state->value = std::move(value);
+        m_state->finish(false, "");
+    }
+
+    void setFailed(const std::string &reason) { m_state->finish(true, reason); }
+
+private:
+    std::shared_ptr<State> m_state;
+};
+
+// 所有future都完成时完成，各自的结果仍从原来的future中获取
+template <typename T>
+MpzrpcFuture<void> mpzrpcWhenAll(std::vector<MpzrpcFuture<T>> &futures)
+{
+    MpzrpcPromise<void> promise;
+    if (futures.empty())
+    {
+        promise.setValue();
+        return promise.getFuture();
+    }
+
+    auto remaining = std::make_shared<std::atomic_size_t>(futures.size());
+    for (auto &future : futures)
+    {
+        future.then([remaining, promise](MpzrpcFuture<T> &) mutable {
+            if (--*remaining == 0)
+            {
+                promise.setValue();
+            }
+        });
+    }
+    return promise.getFuture();
+}
+
+// 不同类型future的版本，如 mpzrpcWhenAll(login_future, register_future)
+template <typename... Ts>
+MpzrpcFuture<void> mpzrpcWhenAll(MpzrpcFuture<Ts> &... futures)
+{
+    MpzrpcPromise<void> promise;
+    if (sizeof...(Ts) == 0)
+    {
+        promise.setValue();
+        return promise.getFuture();
+    }
+
+    auto remaining = std::make_shared<std::atomic_size_t>(sizeof...(Ts));
+    auto on_complete = [remaining, promise]() mutable {
+        if (--*remaining == 0)
+        {
+            promise.setValue();
+        }
+    };
+    (futures.then([on_complete](MpzrpcFuture<Ts> &) mutable { on_complete(); }), ...);
+    return promise.getFuture();
+}
+
+namespace mpzrpc_detail
+{
+// 一次future风格调用的上下文，由done回调负责释放
+template <typename Response>
+struct FutureCall
+{
+    MpzrpcPromise<Response> promise;
+    MpzrpcController controller;
+};
+
+template <typename Response>
+void FinishFutureCall(FutureCall<Response> *call)
+{
+    if (call->controller.Failed())
+    {
+        call->promise.setFailed(call->controller.ErrorText());
+    }
+    else
+    {
+        call->promise.setValue();
+    }
+    delete call;
+}
+} // namespace mpzrpc_detail
+
+// 通过stub发起异步调用，立即返回future，不占用任何等待线程
+// 用法: auto f = mpzrpcCall(stub, &example::UserRpcService_Stub::Login, request);
+// request在返回前已经序列化，调用返回后即可释放
+template <typename Stub, typename Request, typename Response>
+MpzrpcFuture<Response> mpzrpcCall(Stub &stub,
+                                  void (Stub::*method)(google::protobuf::RpcController *,
+                                                       const Request *,
+                                                       Response *,
+                                                       google::protobuf::Closure *),
+                                  const Request &request)
+{
+    auto *call = new mpzrpc_detail::FutureCall<Response>();
+    MpzrpcFuture<Response> future = call->promise.getFuture();
+    google::protobuf::Closure *done = google::protobuf::NewCallback(&mpzrpc_detail::FinishFutureCall<Response>, call);
+    (stub.*method)(&call->controller, &request, call->promise.valuePtr(), done);
+    return future;
+}
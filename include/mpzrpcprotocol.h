@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// 固定格式的帧头，作为protobuf编码rpcheader之外的可选帧格式
+// 请求帧: [MpzrpcFixedHeader][args]
+// 响应帧: [MpzrpcFixedHeader][response]，status不为OK时帧体是错误描述
+// 帧头长度固定，读取时只需一次长度检查，不需要反序列化和内存分配
+// 固定格式只携带method_id，方法编号未协商前仍使用protobuf帧按名字调用
+// 固定格式不携带调用方身份(tenant)，服务端沿用同一连接上protobuf帧带来的身份
+
+// 魔数 "MPZR"，protobuf帧开头的4字节是header_size，不可能这么大，据此区分两种帧
+const uint32_t kMpzrpcFixedMagic = 0x4D505A52;
+const uint8_t kMpzrpcFixedVersion = 2;
+const size_t kMpzrpcFixedHeaderSize = 28;
+
+// flags中的标志位
+const uint8_t kMpzrpcFlagResponse = 0x01;
+const uint8_t kMpzrpcFlagCancel = 0x02;     // 取消request_id对应的调用，没有帧体，服务端不回复
+
+struct MpzrpcFixedHeader
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t flags;
+    uint16_t status;        // 响应的状态码，即rpcheader::StatusCode；请求中为优先级，即rpcheader::Priority
+    uint32_t method_id;     // 请求的方法编号，响应中为0
+    uint64_t request_id;
+    uint32_t body_size;     // 帧头之后的字节数
+    uint32_t timeout_ms;    // 请求的剩余超时时间，0表示不限制，响应中为0
+};
+
+// 按网络字节序编码到buf，buf至少有kMpzrpcFixedHeaderSize字节
+void MpzrpcEncodeFixedHeader(const MpzrpcFixedHeader &header, char *buf);
+
+// 从buf解码，魔数或版本不符时返回false
+bool MpzrpcDecodeFixedHeader(const char *buf, MpzrpcFixedHeader *header);
@@ -7,12 +7,130 @@
 #include <muduo/net/InetAddress.h>
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <climits>
 #include <google/protobuf/descriptor.h>
 
-// 前向声明线程池类，避免在头文件中引入完整的threadpool.h
+#include "rpcheader.pb.h"
+#include "mpzrpccoroutine.h"
+#include "mpzrpcarenapool.h"
+#include "mpzrpcservercontroller.h"
+#include "mpzrpcscheduler.h"
+#include "mpzrpcconcurrencylimiter.h"
+#include "mpzrpcconfig.h"
+
+// 只引入线程池接口，避免在头文件中引入完整的threadpool.h
 // 这样可以减少头文件依赖，加快编译速度
-class ThreadPool;
+#include "executor.h"
+
+class MpzrpcProvider;
+
+struct RpcConnectionContext;
+struct BusinessPool;
+
+// 回复一个请求所需的信息，解析请求失败时也要据此回复错误帧
+struct RpcReplyInfo
+{
+    muduo::net::TcpConnectionPtr conn;
+    uint64_t request_id;
+    uint32_t method_id;     // 请求按名字调用时，在响应中告知的方法编号，否则为0
+    bool fixed_format;      // 请求使用固定格式帧头，响应也用固定格式
+};
+
+// 一次RPC调用在服务端的上下文，和request、response一起分配在本次调用的Arena上
+// 它本身就是传给业务方法的done，也是投递到业务线程池的任务，Arena回收时随之回收
+struct RpcCallContext : public google::protobuf::Closure
+{
+    RpcCallContext(MpzrpcProvider *p, const RpcReplyInfo &r) : provider(p), reply(r) {}
+
+    // 业务方法调用done->Run()时回复响应
+    void Run() override;
+
+    MpzrpcProvider *provider;
+    RpcReplyInfo reply;
+    google::protobuf::Service *service = nullptr;
+    const google::protobuf::MethodDescriptor *method = nullptr;
+    google::protobuf::Message *request = nullptr;
+    google::protobuf::Message *response = nullptr;
+    MpzrpcPooledArena *arena = nullptr;   // 本次调用的request、response和上下文都分配在其上
+    RpcConnectionContext *connection = nullptr;   // 所属连接的状态，连接对象由reply.conn保持存活
+    MpzrpcServerController controller;    // 传给业务方法，带有调用方的地址、截止时间和取消状态
+    int priority_class = 0;               // 在业务线程池前排队时的调度等级
+    BusinessPool *pool = nullptr;         // 接收本次调用的业务线程池，IO线程中直接执行时为nullptr
+    MpzrpcCallScheduler::Tenant *tenant = nullptr;  // 所属的调用方，出队执行的调用结束时据此修正其额度
+    bool queued = false;                  // 还在调度队列中等待，由scheduler的锁保护
+    RpcCallContext *sched_prev = nullptr; // 所属调用方的排队链表
+    RpcCallContext *sched_next = nullptr;
+    int64_t charged_us = 0;               // 出队时预扣的额度(微秒)
+    bool limited = false;                 // 占用了线程池并发限制的一个名额，结束时归还
+
+    // 所属连接的在途调用链表和request_id索引，登记时不需要分配内存，由calls_mutex保护
+    bool active = false;
+    RpcCallContext *active_prev = nullptr;
+    RpcCallContext *active_next = nullptr;
+    RpcCallContext *index_next = nullptr;
+};
+
+// 每条客户端连接的状态，连接建立时保存到TcpConnection的context中
+struct RpcConnectionContext
+{
+    // 已完成但还没写出的响应帧，IO线程每次唤醒时一次写出
+    std::mutex send_mutex;
+    muduo::net::Buffer pending_frames;
+    bool flush_scheduled = false;
+
+    RpcConnectionContext();
+
+    // 尚未结束的调用，连接断开或收到取消帧时据此取消它们，调用结束释放Arena前必须先移除
+    // 调用上下文本身就是链表和索引的节点，登记和移除都不分配内存，以下方法须持有calls_mutex调用
+    void linkCall(RpcCallContext *call);
+    void unlinkCall(RpcCallContext *call);   // 未登记或已移除时什么也不做
+    RpcCallContext *findCall(uint64_t request_id) const;
+
+    std::mutex calls_mutex;
+    RpcCallContext *active_head = nullptr;           // 所有在途调用的双向链表
+    std::vector<RpcCallContext *> call_index;        // request_id的开链哈希桶，建立连接时预留
+    size_t active_count = 0;
+
+    // 调用方身份，默认为对端IP，由protobuf帧中的tenant覆盖，固定格式帧沿用它
+    // 只在连接所属的IO线程中读写
+    std::string tenant;
+};
+using spRpcConnectionContext = std::shared_ptr<RpcConnectionContext>;
+
+// 发布服务时的可选项
+struct MpzrpcServiceOptions
+{
+    // 在muduo的IO线程中直接执行，省去交给业务线程池再切换回来的开销
+    // 只适合耗时极短且不会阻塞的方法，阻塞会拖住同一IO线程上的所有连接
+    bool run_inline = false;                        // 服务的所有方法
+    std::unordered_set<std::string> inline_methods; // 只对这些方法生效
+
+    // 执行方法的业务线程池名，线程池需通过addThreadPool或配置文件的threadpools定义
+    // 为空时使用默认线程池，配置文件中的methodpools优先于这里的设置
+    std::string pool;                                           // 服务的所有方法
+    std::unordered_map<std::string, std::string> method_pools;  // 方法名 -> 线程池名
+};
+
+// 一组独立的业务线程，慢方法分到单独的池中后不会占满其他方法的线程(舱壁隔离)
+// 请求先按优先级和调用方进入scheduler，每入队一个请求向executor投递一个任务，任务执行时才决定取出哪个请求
+struct BusinessPool
+{
+    BusinessPool(const std::string &n, int max_queued_calls, int tenant_quantum_us)
+        : name(n), scheduler(max_queued_calls, tenant_quantum_us) {}
+
+    std::string name;
+    MpzrpcCallScheduler scheduler;          // 等待业务线程的请求，max_queued_calls为0表示不限制
+    std::unique_ptr<MpzrpcConcurrencyLimiter> limiter;  // 自适应并发限制，nullptr表示不限制
+    std::unique_ptr<Executor> executor;
+    MpzrpcResumeExecutor resume_executor;   // 协程处理函数co_await后回到本线程池继续执行
+};
 
 class MpzrpcProvider
 {
@@ -25,6 +143,11 @@ public:
 
     // 发布服务
     void publishService(::google::protobuf::Service *service);
+    void publishService(::google::protobuf::Service *service, const MpzrpcServiceOptions &options);
+
+    // 定义一个独立的业务线程池，须在run之前调用，配置文件中的同名线程池优先
+    // "default"由businessthreadnum配置，不能在这里定义；thread_num不大于0时按1个线程创建
+    void addThreadPool(const std::string &name, int thread_num, int max_queued_calls = 0);
 
     // 启动RPC服务
     void run();
@@ -37,20 +160,102 @@ public:
                            muduo::net::Buffer *buffer,
                            muduo::Timestamp receiveTime);
 
-    // 发送RPC响应
-    void SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response);
+    // 发送RPC响应，业务方法调用done时执行，执行后释放本次调用的Arena
+    void SendRpcResponse(RpcCallContext *call);
+
+    // 执行一次调用，在业务线程中或者在IO线程中直接执行
+    void ExecuteCall(RpcCallContext *call);
+
+    // 处理取消帧，标记连接上request_id对应的调用为已取消
+    void CancelCall(RpcConnectionContext *connection, uint64_t request_id);
+
+    // 已取消的调用还在调度队列中时移除它，返回true时由调用方结束它，须持有所属连接的calls_mutex
+    bool DropQueuedCall(RpcCallContext *call);
+
+    // 结束一次调用: 从连接的在途调用中移除，释放Arena，执行未触发的NotifyOnCancel回调
+    void FinishCall(RpcCallContext *call);
+
+    // 取得线程池中各调度等级的统计，stats至少有MpzrpcCallScheduler::kClassCount个元素
+    // 线程池不存在时返回false，可在任意线程调用
+    bool getSchedulerStats(const std::string &pool_name, MpzrpcCallScheduler::ClassStats *stats) const;
 
 private:
+    // 按请求所用的帧格式发送响应，status不为OK时response为nullptr
+    // 响应直接序列化进发送缓冲区，可在任意线程调用
+    void SendRpcFrame(const RpcReplyInfo &reply,
+                      rpcheader::StatusCode status,
+                      const std::string &error_text,
+                      const google::protobuf::Message *response);
+
+    // 创建所有业务线程池，并为每个方法确定所用的线程池
+    void CreateBusinessPools();
+
+    // 请求加入线程池的调度队列，并投递一个取请求执行的任务
+    void DispatchCall(BusinessPool *pool, RpcCallContext *call, const std::string &tenant);
+
+    // 定期把各线程池每个调度等级的排队数写入日志
+    void LogSchedulerStats() const;
+
+    // 定期删除调度队列中长时间空闲的调用方
+    void ExpireIdleTenants();
+
+    // 定期汇总输出期间被拒绝或丢弃的请求数，过载时不逐个请求写日志
+    void LogDroppedCalls();
+
+    // 把帧加入连接的待发送缓冲区，可在任意线程调用
+    void QueueRpcFrame(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *frame);
+
+    // protobuf帧头长度的合理上限，超过即视为数据错乱
+    static const uint32_t kMaxHeaderSize = 64 * 1024;
+
+    // 清理空闲调用方的间隔(秒)，调用方空闲一到两个间隔后被删除
+    static const int kTenantExpireSeconds = 60;
+
+    // 汇总输出被丢弃请求数的间隔(秒)
+    static const int kDropLogSeconds = 1;
+
     // 服务信息结构体
     struct ServiceInfo
     {
         google::protobuf::Service *m_service;
-        std::unordered_map<std::string, const google::protobuf::MethodDescriptor *> m_methodmap;
+        std::unordered_map<std::string, uint32_t> m_methodmap; // 方法名 -> 方法编号
+    };
+
+    // 方法编号对应的服务和方法
+    struct MethodInfo
+    {
+        google::protobuf::Service *m_service;
+        const google::protobuf::MethodDescriptor *m_method;
+        bool m_inline; // 在IO线程中直接执行
+        std::string m_poolName; // publishService时指定的线程池名
+        BusinessPool *m_pool;   // run时确定的业务线程池
     };
 
     // 存储所有已注册的服务
     std::unordered_map<std::string, ServiceInfo> m_servicemap;
 
-    // 持有业务线程池的智能指针
-    std::unique_ptr<ThreadPool> m_threadPool;
+    // 所有已注册的方法，method_id - 1 即为下标，请求分发时直接按下标查找
+    std::vector<MethodInfo> m_methodTable;
+
+    // 所有业务线程池: 线程池名 -> 线程池，默认线程池名为 "default"
+    std::unordered_map<std::string, std::unique_ptr<BusinessPool>> m_pools;
+    // addThreadPool定义的线程池
+    std::unordered_map<std::string, MpzrpcPoolConfig> m_poolConfigs;
+
+    // 分片模式，所有方法都在IO线程中直接执行
+    bool m_shardMode = false;
+
+    // 排队超时的请求直接回复OVERLOADED，队列长度的上限按线程池分别设置
+    int m_maxQueueWaitMs = 0;
+
+    // 请求体长度的上限，超过即视为数据错乱并断开连接
+    uint32_t m_maxRequestSize = INT_MAX;
+
+    // 上次汇总以来因过载被拒绝、排队超时、执行前已过截止时间而丢弃的请求数
+    std::atomic_uint64_t m_shedCalls{0};
+    std::atomic_uint64_t m_queueTimeoutCalls{0};
+    std::atomic_uint64_t m_deadlineDroppedCalls{0};
+
+    // 每次调用使用的Arena
+    MpzrpcArenaPool m_arenaPool;
 };
\ No newline at end of file
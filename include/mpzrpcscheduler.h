@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "rpcheader.pb.h"
+
+struct RpcCallContext;
+
+// 业务线程池前的调度队列，请求按优先级分成几个等级分别排队
+// 业务线程每次取出等级最高的请求执行(严格优先级)；
+// 排队数达到上限时挤掉更低等级中最后到达的请求，过载时低优先级的请求最先被丢弃
+//
+// 同一等级内按调用方(tenant)分别排队，用差额轮询(DRR)在调用方之间分配业务线程的时间:
+// 轮到的调用方每轮获得quantum微秒的额度，取出请求时先按它的平均耗时扣除额度，
+// 调用结束后再按实际耗时修正，额度用完就轮到下一个调用方。
+// 发送大量或昂贵请求的调用方只会拉长自己的排队时间，不会挤占其他调用方
+//
+// 代价是每次入队和出队都要持有一次本线程池的m_mutex，IO线程和所有业务线程又回到争抢同一把锁。
+// 只有一个调用方、一个等级时调度没有任何意义，bypass让这种线程池的请求不经过队列，
+// 直接投递给业务线程池，只用几个原子计数维持排队上限；出现第二个调用方或等级后才开始排队调度
+class MpzrpcCallScheduler
+{
+public:
+    // 调度等级，0最高: HIGH, NORMAL, LOW, BATCH
+    static const int kClassCount = 4;
+
+    // 每个等级的统计
+    struct ClassStats
+    {
+        size_t queued = 0;       // 当前排队数
+        size_t tenants = 0;      // 当前有请求排队的调用方数
+        uint64_t dispatched = 0; // 累计出队执行数
+        uint64_t shed = 0;       // 累计因过载被拒绝或被挤掉的请求数
+    };
+
+    // 一个调用方的排队状态，创建后一直保留，空闲较久后由expireIdleTenants删除
+    struct Tenant;
+
+    // max_queued为所有等级排队数之和的上限，0表示不限制
+    // quantum_us为调用方每轮获得的额度(微秒)
+    MpzrpcCallScheduler(int max_queued, int quantum_us);
+    ~MpzrpcCallScheduler();
+
+    // 请求的优先级对应的调度等级，未知的取值按NORMAL处理
+    static int ClassOf(rpcheader::Priority priority);
+
+    // bypass的结果
+    enum BypassResult
+    {
+        kBypassQueue,   // 需要经过push排队
+        kBypassRun,     // 可以直接投递执行，开始执行时须调用bypassStarted
+        kBypassReject,  // 排队数已达上限或over_limit，唯一的调用方只能拒绝自己的请求
+    };
+
+    // 到目前为止只有一个调用方、一个等级时不需要排队调度，不持有m_mutex
+    // 第一次出现第二个调用方或等级后一直返回kBypassQueue，不再切换回来，避免不加锁读取时调用方被改写
+    BypassResult bypass(int cls, const std::string &tenant, bool over_limit);
+    void bypassStarted();
+
+    // 按call->priority_class入队，tenant为调用方身份，队列已满或over_limit(超出并发上限)时:
+    // 有可以挤掉的请求(更低等级的，或同一等级中排队比自己多的调用方的)则挤掉一个，
+    // 通过shed返回，由调用方回复过载；否则不入队并返回false
+    bool push(RpcCallContext *call, const std::string &tenant, bool over_limit, RpcCallContext **shed);
+
+    // 取出等级最高的请求，同一等级内按DRR选择调用方，队列为空时返回nullptr
+    RpcCallContext *pop();
+
+    // 移除还在排队的请求(如已被取消)，请求已被取出或挤掉时返回false
+    bool remove(RpcCallContext *call);
+
+    // pop取出的请求结束时调用，按实际耗时修正所属调用方的额度
+    void finish(RpcCallContext *call, int64_t cost_us);
+
+    ClassStats stats(int cls) const;
+
+    // 删除上一次调用以来一直空闲(没有排队和执行中的请求，也没有新请求)的调用方，返回删除的个数
+    // 调用方的状态在两次调用之间保留，请求一个接一个到来时不会反复创建和销毁，平均耗时也能延续下去
+    size_t expireIdleTenants();
+
+private:
+    // 为cls等级的owner选出可以挤掉请求的调用方，owner_queued为owner在cls等级的排队数(含新请求)
+    // 找到时通过victim_cls返回其等级，没有可以挤掉的返回nullptr
+    Tenant *pickVictim(Tenant *owner, int cls, size_t owner_queued, int *victim_cls) const;
+
+    // 调用方在cls等级中排队最多的那个，用于过载时挤掉
+    Tenant *longestTenant(int cls) const;
+
+    // 从调用方的cls队列尾部移除一个请求
+    RpcCallContext *removeBack(Tenant *tenant, int cls);
+
+    // cls等级的调用方轮转环，环头是当前轮到的调用方
+    void ringPushBack(int cls, Tenant *tenant);
+    void ringErase(int cls, Tenant *tenant);
+    void ringRotate(int cls);
+
+    // bypass的状态: 还没有请求、只有一个调用方和等级、已经需要调度
+    enum BypassMode
+    {
+        kModeUnknown,
+        kModeSingle,
+        kModeShared,
+    };
+
+    const size_t m_maxQueued;
+    const int64_t m_quantumUs;
+    mutable std::mutex m_mutex;
+
+    // kModeSingle时m_singleClass和m_singleTenant不再修改，可以不加锁读取
+    std::atomic_int m_mode{kModeUnknown};
+    int m_singleClass = 0;
+    std::string m_singleTenant;
+    std::atomic_size_t m_bypassQueued{0};       // 直接投递、还没开始执行的请求数
+    std::atomic_uint64_t m_bypassDispatched{0};
+    std::atomic_uint64_t m_bypassShed{0};
+    std::unordered_map<std::string, Tenant *> m_tenants;
+    // 每个等级中有请求排队的调用方组成的环，节点指针在Tenant中，入队出队都不分配内存
+    Tenant *m_ring[kClassCount] = {};
+    size_t m_ringSize[kClassCount] = {};
+    size_t m_size = 0;
+    ClassStats m_stats[kClassCount];
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <google/protobuf/service.h>
+#include <muduo/net/InetAddress.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+// 服务端传给业务方法的controller
+// 业务方法可以据此得知调用方地址、截止时间和是否已被取消，尽早放弃注定无用的工作
+// 调用SetFailed后框架回复错误帧而不是response
+class MpzrpcServerController : public google::protobuf::RpcController
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    MpzrpcServerController();
+
+    // 以下为客户端使用的接口，服务端无意义
+    void Reset();
+    bool Failed() const;
+    std::string ErrorText() const;
+    void StartCancel();
+
+    // 以下为服务端使用的接口
+    void SetFailed(const std::string &reason);
+    // 调用方连接断开或取消了调用
+    bool IsCanceled() const;
+    // callback恰好执行一次: 调用被取消时立即执行，否则在响应发出后执行
+    void NotifyOnCancel(google::protobuf::Closure *callback);
+
+    // 调用方地址
+    const muduo::net::InetAddress &PeerAddress() const { return m_peer; }
+    std::string Peer() const { return m_peer.toIpPort(); }
+
+    // 调用方的截止时间，由框架根据请求中的超时时间设置
+    void SetDeadline(Clock::time_point deadline);
+    bool HasDeadline() const;
+    Clock::time_point Deadline() const;
+
+    // 剩余的时间预算(毫秒)，没有截止时间时返回-1，已经过期返回0
+    int64_t RemainingMs() const;
+    bool IsExpired() const;
+
+    // 各阶段的时间点: 收到请求、提交到业务线程池、开始执行
+    Clock::time_point ReceiveTime() const { return m_receiveTime; }
+    Clock::time_point EnqueueTime() const { return m_enqueueTime; }
+    Clock::time_point StartTime() const { return m_startTime; }
+
+    // 以下由框架调用
+    void SetPeer(const muduo::net::InetAddress &peer) { m_peer = peer; }
+    void MarkReceived(Clock::time_point t) { m_receiveTime = t; }
+    void MarkEnqueued() { m_enqueueTime = Clock::now(); }
+    void MarkStarted() { m_startTime = Clock::now(); }
+    // 标记为已取消，返回需要执行的NotifyOnCancel回调(可能为nullptr)
+    google::protobuf::Closure *SetCanceled();
+    // 调用结束，取出未执行的NotifyOnCancel回调(可能为nullptr)
+    google::protobuf::Closure *TakeCancelCallback();
+
+private:
+    bool m_failed;         // RPC方法执行过程中的状态
+    std::string m_errText; // RPC方法执行过程中的错误信息
+    bool m_hasDeadline;
+    Clock::time_point m_deadline;
+    muduo::net::InetAddress m_peer;
+    Clock::time_point m_receiveTime;
+    Clock::time_point m_enqueueTime;
+    Clock::time_point m_startTime;
+
+    // 取消由IO线程发起，与业务线程并发
+    std::atomic_bool m_canceled;
+    std::mutex m_cancelMutex;
+    google::protobuf::Closure *m_cancelCallback;
+};
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -48,12 +49,74 @@ namespace rpcheader {
 class rpcheader;
 struct rpcheaderDefaultTypeInternal;
 extern rpcheaderDefaultTypeInternal _rpcheader_default_instance_;
+class rpcresponseheader;
+struct rpcresponseheaderDefaultTypeInternal;
+extern rpcresponseheaderDefaultTypeInternal _rpcresponseheader_default_instance_;
 }  // namespace rpcheader
 PROTOBUF_NAMESPACE_OPEN
 template<> ::rpcheader::rpcheader* Arena::CreateMaybeMessage<::rpcheader::rpcheader>(Arena*);
+template<> ::rpcheader::rpcresponseheader* Arena::CreateMaybeMessage<::rpcheader::rpcresponseheader>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace rpcheader {
 
+enum Priority : int {
+  PRIORITY_NORMAL = 0,
+  PRIORITY_HIGH = 1,
+  PRIORITY_LOW = 2,
+  PRIORITY_BATCH = 3,
+  Priority_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Priority_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Priority_IsValid(int value);
+constexpr Priority Priority_MIN = PRIORITY_NORMAL;
+constexpr Priority Priority_MAX = PRIORITY_BATCH;
+constexpr int Priority_ARRAYSIZE = Priority_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Priority_descriptor();
+template<typename T>
+inline const std::string& Priority_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Priority>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Priority_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Priority_descriptor(), enum_t_value);
+}
+inline bool Priority_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Priority* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Priority>(
+    Priority_descriptor(), name, value);
+}
+enum StatusCode : int {
+  OK = 0,
+  SERVICE_NOT_FOUND = 1,
+  METHOD_NOT_FOUND = 2,
+  REQUEST_PARSE_ERROR = 3,
+  INTERNAL_ERROR = 4,
+  OVERLOADED = 5,
+  DEADLINE_EXCEEDED = 6,
+  APPLICATION_ERROR = 7,
+  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StatusCode_IsValid(int value);
+constexpr StatusCode StatusCode_MIN = OK;
+constexpr StatusCode StatusCode_MAX = APPLICATION_ERROR;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
+}
+inline bool StatusCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
+    StatusCode_descriptor(), name, value);
+}
 // ===================================================================
 
 class rpcheader final :
@@ -136,9 +199,11 @@ class rpcheader final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const rpcheader& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const rpcheader& from);
+  void MergeFrom( const rpcheader& from) {
+    rpcheader::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -147,10 +212,10 @@ class rpcheader final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(rpcheader* other);
@@ -177,7 +242,13 @@ class rpcheader final :
   enum : int {
     kServiceNameFieldNumber = 1,
     kMethodNameFieldNumber = 2,
+    kTenantFieldNumber = 9,
+    kRequestIdFieldNumber = 4,
     kArgsSizeFieldNumber = 3,
+    kMethodIdFieldNumber = 5,
+    kTimeoutMsFieldNumber = 6,
+    kCancelFieldNumber = 7,
+    kPriorityFieldNumber = 8,
   };
   // bytes service_name = 1;
   void clear_service_name();
@@ -207,6 +278,29 @@ class rpcheader final :
   std::string* _internal_mutable_method_name();
   public:
 
+  // bytes tenant = 9;
+  void clear_tenant();
+  const std::string& tenant() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant();
+  PROTOBUF_NODISCARD std::string* release_tenant();
+  void set_allocated_tenant(std::string* tenant);
+  private:
+  const std::string& _internal_tenant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant(const std::string& value);
+  std::string* _internal_mutable_tenant();
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
   // uint32 args_size = 3;
   void clear_args_size();
   uint32_t args_size() const;
@@ -216,6 +310,42 @@ class rpcheader final :
   void _internal_set_args_size(uint32_t value);
   public:
 
+  // uint32 method_id = 5;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 6;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // bool cancel = 7;
+  void clear_cancel();
+  bool cancel() const;
+  void set_cancel(bool value);
+  private:
+  bool _internal_cancel() const;
+  void _internal_set_cancel(bool value);
+  public:
+
+  // .rpcheader.Priority priority = 8;
+  void clear_priority();
+  ::rpcheader::Priority priority() const;
+  void set_priority(::rpcheader::Priority value);
+  private:
+  ::rpcheader::Priority _internal_priority() const;
+  void _internal_set_priority(::rpcheader::Priority value);
+  public:
+
   // @@protoc_insertion_point(class_scope:rpcheader.rpcheader)
  private:
   class _Internal;
@@ -223,10 +353,216 @@ class rpcheader final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
-  uint32_t args_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_;
+    uint64_t request_id_;
+    uint32_t args_size_;
+    uint32_t method_id_;
+    uint32_t timeout_ms_;
+    bool cancel_;
+    int priority_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class rpcresponseheader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:rpcheader.rpcresponseheader) */ {
+ public:
+  inline rpcresponseheader() : rpcresponseheader(nullptr) {}
+  ~rpcresponseheader() override;
+  explicit PROTOBUF_CONSTEXPR rpcresponseheader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  rpcresponseheader(const rpcresponseheader& from);
+  rpcresponseheader(rpcresponseheader&& from) noexcept
+    : rpcresponseheader() {
+    *this = ::std::move(from);
+  }
+
+  inline rpcresponseheader& operator=(const rpcresponseheader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline rpcresponseheader& operator=(rpcresponseheader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const rpcresponseheader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const rpcresponseheader* internal_default_instance() {
+    return reinterpret_cast<const rpcresponseheader*>(
+               &_rpcresponseheader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(rpcresponseheader& a, rpcresponseheader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(rpcresponseheader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(rpcresponseheader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  rpcresponseheader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<rpcresponseheader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const rpcresponseheader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const rpcresponseheader& from) {
+    rpcresponseheader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(rpcresponseheader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "rpcheader.rpcresponseheader";
+  }
+  protected:
+  explicit rpcresponseheader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 3,
+    kResponseSizeFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kRequestIdFieldNumber = 4,
+    kMethodIdFieldNumber = 5,
+  };
+  // bytes error_text = 3;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // uint32 response_size = 1;
+  void clear_response_size();
+  uint32_t response_size() const;
+  void set_response_size(uint32_t value);
+  private:
+  uint32_t _internal_response_size() const;
+  void _internal_set_response_size(uint32_t value);
+  public:
+
+  // .rpcheader.StatusCode status = 2;
+  void clear_status();
+  ::rpcheader::StatusCode status() const;
+  void set_status(::rpcheader::StatusCode value);
+  private:
+  ::rpcheader::StatusCode _internal_status() const;
+  void _internal_set_status(::rpcheader::StatusCode value);
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 method_id = 5;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:rpcheader.rpcresponseheader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    uint32_t response_size_;
+    int status_;
+    uint64_t request_id_;
+    uint32_t method_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_rpcheader_2eproto;
 };
 // ===================================================================
@@ -242,7 +578,7 @@ class rpcheader final :
 
 // bytes service_name = 1;
 inline void rpcheader::clear_service_name() {
-  service_name_.ClearToEmpty();
+  _impl_.service_name_.ClearToEmpty();
 }
 inline const std::string& rpcheader::service_name() const {
   // @@protoc_insertion_point(field_get:rpcheader.rpcheader.service_name)
@@ -252,7 +588,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void rpcheader::set_service_name(ArgT0&& arg0, ArgT... args) {
  
- service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:rpcheader.rpcheader.service_name)
 }
 inline std::string* rpcheader::mutable_service_name() {
@@ -261,19 +597,19 @@ inline std::string* rpcheader::mutable_service_name() {
   return _s;
 }
 inline const std::string& rpcheader::_internal_service_name() const {
-  return service_name_.Get();
+  return _impl_.service_name_.Get();
 }
 inline void rpcheader::_internal_set_service_name(const std::string& value) {
   
-  service_name_.Set(value, GetArenaForAllocation());
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* rpcheader::_internal_mutable_service_name() {
   
-  return service_name_.Mutable(GetArenaForAllocation());
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* rpcheader::release_service_name() {
   // @@protoc_insertion_point(field_release:rpcheader.rpcheader.service_name)
-  return service_name_.Release();
+  return _impl_.service_name_.Release();
 }
 inline void rpcheader::set_allocated_service_name(std::string* service_name) {
   if (service_name != nullptr) {
@@ -281,10 +617,10 @@ inline void rpcheader::set_allocated_service_name(std::string* service_name) {
   } else {
     
   }
-  service_name_.SetAllocated(service_name, GetArenaForAllocation());
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (service_name_.IsDefault()) {
-    service_name_.Set("", GetArenaForAllocation());
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:rpcheader.rpcheader.service_name)
@@ -292,7 +628,7 @@ inline void rpcheader::set_allocated_service_name(std::string* service_name) {
 
 // bytes method_name = 2;
 inline void rpcheader::clear_method_name() {
-  method_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
 }
 inline const std::string& rpcheader::method_name() const {
   // @@protoc_insertion_point(field_get:rpcheader.rpcheader.method_name)
@@ -302,7 +638,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void rpcheader::set_method_name(ArgT0&& arg0, ArgT... args) {
  
- method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:rpcheader.rpcheader.method_name)
 }
 inline std::string* rpcheader::mutable_method_name() {
@@ -311,19 +647,19 @@ inline std::string* rpcheader::mutable_method_name() {
   return _s;
 }
 inline const std::string& rpcheader::_internal_method_name() const {
-  return method_name_.Get();
+  return _impl_.method_name_.Get();
 }
 inline void rpcheader::_internal_set_method_name(const std::string& value) {
   
-  method_name_.Set(value, GetArenaForAllocation());
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* rpcheader::_internal_mutable_method_name() {
   
-  return method_name_.Mutable(GetArenaForAllocation());
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* rpcheader::release_method_name() {
   // @@protoc_insertion_point(field_release:rpcheader.rpcheader.method_name)
-  return method_name_.Release();
+  return _impl_.method_name_.Release();
 }
 inline void rpcheader::set_allocated_method_name(std::string* method_name) {
   if (method_name != nullptr) {
@@ -331,10 +667,10 @@ inline void rpcheader::set_allocated_method_name(std::string* method_name) {
   } else {
     
   }
-  method_name_.SetAllocated(method_name, GetArenaForAllocation());
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (method_name_.IsDefault()) {
-    method_name_.Set("", GetArenaForAllocation());
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:rpcheader.rpcheader.method_name)
@@ -342,10 +678,10 @@ inline void rpcheader::set_allocated_method_name(std::string* method_name) {
 
 // uint32 args_size = 3;
 inline void rpcheader::clear_args_size() {
-  args_size_ = 0u;
+  _impl_.args_size_ = 0u;
 }
 inline uint32_t rpcheader::_internal_args_size() const {
-  return args_size_;
+  return _impl_.args_size_;
 }
 inline uint32_t rpcheader::args_size() const {
   // @@protoc_insertion_point(field_get:rpcheader.rpcheader.args_size)
@@ -353,21 +689,322 @@ inline uint32_t rpcheader::args_size() const {
 }
 inline void rpcheader::_internal_set_args_size(uint32_t value) {
   
-  args_size_ = value;
+  _impl_.args_size_ = value;
 }
 inline void rpcheader::set_args_size(uint32_t value) {
   _internal_set_args_size(value);
   // @@protoc_insertion_point(field_set:rpcheader.rpcheader.args_size)
 }
 
+// uint64 request_id = 4;
+inline void rpcheader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t rpcheader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t rpcheader::request_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.request_id)
+  return _internal_request_id();
+}
+inline void rpcheader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void rpcheader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.request_id)
+}
+
+// uint32 method_id = 5;
+inline void rpcheader::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t rpcheader::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t rpcheader::method_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.method_id)
+  return _internal_method_id();
+}
+inline void rpcheader::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void rpcheader::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.method_id)
+}
+
+// uint32 timeout_ms = 6;
+inline void rpcheader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t rpcheader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t rpcheader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void rpcheader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void rpcheader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.timeout_ms)
+}
+
+// bool cancel = 7;
+inline void rpcheader::clear_cancel() {
+  _impl_.cancel_ = false;
+}
+inline bool rpcheader::_internal_cancel() const {
+  return _impl_.cancel_;
+}
+inline bool rpcheader::cancel() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.cancel)
+  return _internal_cancel();
+}
+inline void rpcheader::_internal_set_cancel(bool value) {
+  
+  _impl_.cancel_ = value;
+}
+inline void rpcheader::set_cancel(bool value) {
+  _internal_set_cancel(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.cancel)
+}
+
+// .rpcheader.Priority priority = 8;
+inline void rpcheader::clear_priority() {
+  _impl_.priority_ = 0;
+}
+inline ::rpcheader::Priority rpcheader::_internal_priority() const {
+  return static_cast< ::rpcheader::Priority >(_impl_.priority_);
+}
+inline ::rpcheader::Priority rpcheader::priority() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.priority)
+  return _internal_priority();
+}
+inline void rpcheader::_internal_set_priority(::rpcheader::Priority value) {
+  
+  _impl_.priority_ = value;
+}
+inline void rpcheader::set_priority(::rpcheader::Priority value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.priority)
+}
+
+// bytes tenant = 9;
+inline void rpcheader::clear_tenant() {
+  _impl_.tenant_.ClearToEmpty();
+}
+inline const std::string& rpcheader::tenant() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcheader.tenant)
+  return _internal_tenant();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void rpcheader::set_tenant(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.rpcheader.tenant)
+}
+inline std::string* rpcheader::mutable_tenant() {
+  std::string* _s = _internal_mutable_tenant();
+  // @@protoc_insertion_point(field_mutable:rpcheader.rpcheader.tenant)
+  return _s;
+}
+inline const std::string& rpcheader::_internal_tenant() const {
+  return _impl_.tenant_.Get();
+}
+inline void rpcheader::_internal_set_tenant(const std::string& value) {
+  
+  _impl_.tenant_.Set(value, GetArenaForAllocation());
+}
+inline std::string* rpcheader::_internal_mutable_tenant() {
+  
+  return _impl_.tenant_.Mutable(GetArenaForAllocation());
+}
+inline std::string* rpcheader::release_tenant() {
+  // @@protoc_insertion_point(field_release:rpcheader.rpcheader.tenant)
+  return _impl_.tenant_.Release();
+}
+inline void rpcheader::set_allocated_tenant(std::string* tenant) {
+  if (tenant != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tenant_.SetAllocated(tenant, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_.IsDefault()) {
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.rpcheader.tenant)
+}
+
+// -------------------------------------------------------------------
+
+// rpcresponseheader
+
+// uint32 response_size = 1;
+inline void rpcresponseheader::clear_response_size() {
+  _impl_.response_size_ = 0u;
+}
+inline uint32_t rpcresponseheader::_internal_response_size() const {
+  return _impl_.response_size_;
+}
+inline uint32_t rpcresponseheader::response_size() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcresponseheader.response_size)
+  return _internal_response_size();
+}
+inline void rpcresponseheader::_internal_set_response_size(uint32_t value) {
+  
+  _impl_.response_size_ = value;
+}
+inline void rpcresponseheader::set_response_size(uint32_t value) {
+  _internal_set_response_size(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcresponseheader.response_size)
+}
+
+// .rpcheader.StatusCode status = 2;
+inline void rpcresponseheader::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::rpcheader::StatusCode rpcresponseheader::_internal_status() const {
+  return static_cast< ::rpcheader::StatusCode >(_impl_.status_);
+}
+inline ::rpcheader::StatusCode rpcresponseheader::status() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcresponseheader.status)
+  return _internal_status();
+}
+inline void rpcresponseheader::_internal_set_status(::rpcheader::StatusCode value) {
+  
+  _impl_.status_ = value;
+}
+inline void rpcresponseheader::set_status(::rpcheader::StatusCode value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcresponseheader.status)
+}
+
+// bytes error_text = 3;
+inline void rpcresponseheader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& rpcresponseheader::error_text() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcresponseheader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void rpcresponseheader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:rpcheader.rpcresponseheader.error_text)
+}
+inline std::string* rpcresponseheader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:rpcheader.rpcresponseheader.error_text)
+  return _s;
+}
+inline const std::string& rpcresponseheader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void rpcresponseheader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* rpcresponseheader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* rpcresponseheader::release_error_text() {
+  // @@protoc_insertion_point(field_release:rpcheader.rpcresponseheader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void rpcresponseheader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:rpcheader.rpcresponseheader.error_text)
+}
+
+// uint64 request_id = 4;
+inline void rpcresponseheader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t rpcresponseheader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t rpcresponseheader::request_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcresponseheader.request_id)
+  return _internal_request_id();
+}
+inline void rpcresponseheader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void rpcresponseheader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcresponseheader.request_id)
+}
+
+// uint32 method_id = 5;
+inline void rpcresponseheader::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t rpcresponseheader::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t rpcresponseheader::method_id() const {
+  // @@protoc_insertion_point(field_get:rpcheader.rpcresponseheader.method_id)
+  return _internal_method_id();
+}
+inline void rpcresponseheader::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void rpcresponseheader::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:rpcheader.rpcresponseheader.method_id)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace rpcheader
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::rpcheader::Priority> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcheader::Priority>() {
+  return ::rpcheader::Priority_descriptor();
+}
+template <> struct is_proto_enum< ::rpcheader::StatusCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::rpcheader::StatusCode>() {
+  return ::rpcheader::StatusCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
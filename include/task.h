@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// 线程池任务，只能移动的 void() 可调用对象
+// 不超过kInlineSize的可调用对象直接存放在对象内部，提交任务不需要堆分配；
+// 与std::function不同，可以保存packaged_task这类只能移动的对象
+class Task
+{
+public:
+    static const size_t kInlineSize = 48;
+
+    Task() noexcept : m_ops(nullptr) {}
+
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Task>::value>::type>
+    Task(F &&f)
+    {
+        using Fn = typename std::decay<F>::type;
+        if constexpr (sizeof(Fn) <= kInlineSize &&
+                      alignof(Fn) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Fn>::value)
+        {
+            new (m_storage) Fn(std::forward<F>(f));
+            m_ops = &InlineOps<Fn>::ops;
+        }
+        else
+        {
+            // 过大的可调用对象放到堆上，内部只保存指针
+            *reinterpret_cast<Fn **>(m_storage) = new Fn(std::forward<F>(f));
+            m_ops = &HeapOps<Fn>::ops;
+        }
+    }
+
+    Task(Task &&other) noexcept : m_ops(other.m_ops)
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->move(m_storage, other.m_storage);
+            other.m_ops = nullptr;
+        }
+    }
+
+    Task &operator=(Task &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            m_ops = other.m_ops;
+            if (m_ops != nullptr)
+            {
+                m_ops->move(m_storage, other.m_storage);
+                other.m_ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task() { reset(); }
+
+    explicit operator bool() const { return m_ops != nullptr; }
+
+    void operator()() { m_ops->invoke(m_storage); }
+
+private:
+    struct Ops
+    {
+        void (*invoke)(void *storage);
+        // 把src中的对象移动到dst，并销毁src中的对象
+        void (*move)(void *dst, void *src) noexcept;
+        void (*destroy)(void *storage) noexcept;
+    };
+
+    template <typename Fn>
+    struct InlineOps
+    {
+        static void invoke(void *storage) { (*static_cast<Fn *>(storage))(); }
+        static void move(void *dst, void *src) noexcept
+        {
+            new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        }
+        static void destroy(void *storage) noexcept { static_cast<Fn *>(storage)->~Fn(); }
+        static constexpr Ops ops = {&invoke, &move, &destroy};
+    };
+
+    template <typename Fn>
+    struct HeapOps
+    {
+        static void invoke(void *storage) { (**static_cast<Fn **>(storage))(); }
+        static void move(void *dst, void *src) noexcept { *static_cast<Fn **>(dst) = *static_cast<Fn **>(src); }
+        static void destroy(void *storage) noexcept { delete *static_cast<Fn **>(storage); }
+        static constexpr Ops ops = {&invoke, &move, &destroy};
+    };
+
+    void reset()
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[kInlineSize];
+    const Ops *m_ops;
+};
@@ -8,8 +8,12 @@
 #include <future>
 #include <functional>
 #include <stdexcept>
+#include <type_traits>
 
-class ThreadPool {
+#include "executor.h"
+
+// 所有线程共用一个任务队列的线程池
+class ThreadPool : public Executor {
 public:
     // 构造函数，创建指定数量的线程
     ThreadPool(size_t);
@@ -17,16 +21,20 @@ public:
     // 提交任务到任务队列，返回一个future以便获取返回值
     template<class F, class... Args>
     auto enqueue(F&& f, Args&&... args) 
-        -> std::future<typename std::result_of<F(Args...)>::type>;
+        -> std::future<typename std::invoke_result<F, Args...>::type>;
+    
+    // 提交不需要返回值的任务，不经过packaged_task和future，
+    // 任务直接存放在Task内部，不会产生额外的堆分配
+    void post(Task task) override;
     
     // 析构函数，等待所有线程结束
-    ~ThreadPool();
+    ~ThreadPool() override;
 
 private:
     // 存储工作线程的容器
     std::vector<std::thread> workers;
     // 任务队列
-    std::queue<std::function<void()>> tasks;
+    std::queue<Task> tasks;
     
     // 同步机制
     std::mutex queue_mutex;
@@ -36,11 +44,14 @@ private:
 
 // 构造函数的实现
 inline ThreadPool::ThreadPool(size_t threads) : stop(false) {
+    // 与WorkStealingThreadPool一致，至少创建一个线程，否则提交的任务永远不会执行
+    if(threads == 0)
+        threads = 1;
     for(size_t i = 0; i < threads; ++i)
         workers.emplace_back(
             [this] {
                 for(;;) {
-                    std::function<void()> task;
+                    Task task;
                     {
                         std::unique_lock<std::mutex> lock(this->queue_mutex);
                         this->condition.wait(lock,
@@ -59,27 +70,41 @@ inline ThreadPool::ThreadPool(size_t threads) : stop(false) {
 // 模板函数，将任务添加到队列
 template<class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args) 
-    -> std::future<typename std::result_of<F(Args...)>::type>
+    -> std::future<typename std::invoke_result<F, Args...>::type>
 {
-    using return_type = typename std::result_of<F(Args...)>::type;
+    using return_type = typename std::invoke_result<F, Args...>::type;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
+    // Task可以保存只能移动的packaged_task，不再需要shared_ptr包装
+    std::packaged_task<return_type()> task(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
         
-    std::future<return_type> res = task->get_future();
+    std::future<return_type> res = task.get_future();
     {
         std::unique_lock<std::mutex> lock(queue_mutex);
 
         if(stop)
             throw std::runtime_error("enqueue on stopped ThreadPool");
 
-        tasks.emplace([task](){ (*task)(); });
+        tasks.emplace([task = std::move(task)]() mutable { task(); });
     }
     condition.notify_one();
     return res;
 }
 
+inline void ThreadPool::post(Task task)
+{
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+
+        if(stop)
+            throw std::runtime_error("post on stopped ThreadPool");
+
+        tasks.emplace(std::move(task));
+    }
+    condition.notify_one();
+}
+
 // 析构函数的实现
 inline ThreadPool::~ThreadPool() {
     {
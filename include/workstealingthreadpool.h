@@ -0,0 +1,180 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+#include "executor.h"
+
+// 工作窃取线程池，每个工作线程有自己的任务队列
+// 提交任务只锁目标队列，工作线程自己的队列空了再随机从其他队列窃取，
+// 避免所有IO线程和工作线程争抢同一把锁
+class WorkStealingThreadPool : public Executor {
+public:
+    // 构造函数，创建指定数量的线程
+    explicit WorkStealingThreadPool(size_t threads);
+
+    // 工作线程提交到自己的队列，其他线程(如muduo的IO线程)轮流提交到各个队列
+    void post(Task task) override;
+
+    // 析构函数，执行完剩余任务后等待所有线程结束
+    ~WorkStealingThreadPool() override;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // 当前线程是本线程池的工作线程时返回其下标，否则返回-1
+    long currentWorker() const;
+
+    // 非工作线程下一次提交的队列，每个线程各自轮询所有队列，起点错开
+    // IO线程比工作线程少时，每个工作线程的队列也都能直接收到任务，不必全靠窃取
+    size_t nextQueue() const;
+
+    // 先取自己队列的队头，再从随机位置开始窃取其他队列的队尾
+    bool takeTask(size_t index, Task &task);
+
+    void workerLoop(size_t index);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    // 所有队列中的任务总数和正在休眠的线程数，用于决定是否需要唤醒
+    std::atomic_size_t pending;
+    std::atomic_size_t idle;
+    std::mutex sleep_mutex;
+    std::condition_variable condition;
+    std::atomic_bool stop;
+};
+
+// 记录当前线程属于哪个线程池的哪个工作线程
+struct WorkStealingWorkerInfo {
+    const void *pool = nullptr;
+    size_t index = 0;
+};
+
+inline WorkStealingWorkerInfo &workStealingWorkerInfo()
+{
+    thread_local WorkStealingWorkerInfo info;
+    return info;
+}
+
+inline WorkStealingThreadPool::WorkStealingThreadPool(size_t threads)
+    : pending(0), idle(0), stop(false)
+{
+    if (threads == 0)
+        threads = 1;
+    for (size_t i = 0; i < threads; ++i)
+        queues.emplace_back(new WorkerQueue());
+    for (size_t i = 0; i < threads; ++i)
+        workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+inline long WorkStealingThreadPool::currentWorker() const
+{
+    const WorkStealingWorkerInfo &info = workStealingWorkerInfo();
+    return info.pool == this ? (long)info.index : -1;
+}
+
+inline size_t WorkStealingThreadPool::nextQueue() const
+{
+    // 游标是线程私有的，轮询不需要在IO线程之间共享计数
+    static std::atomic_size_t next_thread(0);
+    thread_local size_t cursor = next_thread++;
+    return cursor++ % queues.size();
+}
+
+inline void WorkStealingThreadPool::post(Task task)
+{
+    if (stop)
+        throw std::runtime_error("post on stopped WorkStealingThreadPool");
+
+    // 先计数再入队，计数不会因为任务被提前取走而减成负数
+    // 与workerLoop中的 ++idle / 检查pending 配对，保证不会丢失唤醒
+    ++pending;
+    long worker = currentWorker();
+    size_t index = worker >= 0 ? (size_t)worker : nextQueue();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+
+    if (idle > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    condition.notify_one();
+}
+
+inline bool WorkStealingThreadPool::takeTask(size_t index, Task &task)
+{
+    {
+        WorkerQueue &own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            --pending;
+            return true;
+        }
+    }
+
+    thread_local std::minstd_rand rng(std::random_device{}());
+    size_t n = queues.size();
+    size_t start = rng() % n;
+    for (size_t k = 0; k < n; ++k) {
+        size_t victim = (start + k) % n;
+        if (victim == index)
+            continue;
+        WorkerQueue &other = *queues[victim];
+        std::unique_lock<std::mutex> lock(other.mutex, std::try_to_lock);
+        if (lock.owns_lock() && !other.tasks.empty()) {
+            task = std::move(other.tasks.back());
+            other.tasks.pop_back();
+            --pending;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void WorkStealingThreadPool::workerLoop(size_t index)
+{
+    WorkStealingWorkerInfo &info = workStealingWorkerInfo();
+    info.pool = this;
+    info.index = index;
+
+    for (;;) {
+        Task task;
+        if (takeTask(index, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        ++idle;
+        // 窃取时用try_lock可能错过任务，任务也可能已计数但还没入队，pending不为0就再试一轮
+        condition.wait(lock, [this] { return stop || pending > 0; });
+        --idle;
+        if (stop && pending == 0)
+            return;
+    }
+}
+
+inline WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
@@ -1,11 +1,17 @@
 #include <string>
+#include <string.h>
 #include <muduo/net/TcpConnection.h>
 #include <functional>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
-#include <poll.h>
+#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <muduo/net/EventLoop.h>
 
 #include "mpzrpcchannel.h"
 #include "logger.h"
@@ -13,13 +19,255 @@
 #include "mpzrpcapplication.h"
 #include "zookeeperutil.h"
 #include "mpzrpcconnectionpool.h"
+#include "mpzrpcclientconnection.h"
 #include "mpzrpccontroller.h"
 #include "mpzrpcloadbalancer.h"
+#include "mpzrpcprotocol.h"
 
 // 初始化静态成员
 std::unordered_map<std::string, std::vector<std::string>> MpzrpcChannel::m_serviceListCache;
 std::mutex MpzrpcChannel::m_cacheMutex;
 
+// 一次已经发出的请求的结果
+struct CallOutcome
+{
+    bool success = false;
+    bool retryable = false;     // 超时或连接断开，同步调用可以换节点重试
+    std::string error_text;
+};
+
+using CallCompletion = std::function<void(const CallOutcome &)>;
+
+// 在途请求，响应回调、超时定时器和发送失败三者中只有一个能完成它
+struct InflightCall
+{
+    std::atomic_bool finished{false};
+    muduo::net::TimerId timer;
+    google::protobuf::Message *response;
+    CallCompletion complete;
+};
+
+static bool UseFixedHeader()
+{
+    static const bool use_fixed_header = MpzrpcApplication::getApp().getConfig().getRpcHeaderFormat() == "fixed";
+    return use_fixed_header;
+}
+
+// 取消帧只携带request_id，服务端收到后丢弃排队中的调用或标记运行中的调用
+static std::string BuildCancelFrame(uint64_t request_id)
+{
+    if (UseFixedHeader()) {
+        MpzrpcFixedHeader header = {kMpzrpcFixedMagic, kMpzrpcFixedVersion, kMpzrpcFlagCancel, 0, 0, request_id, 0, 0};
+        std::string frame(kMpzrpcFixedHeaderSize, '\0');
+        MpzrpcEncodeFixedHeader(header, &frame[0]);
+        return frame;
+    }
+
+    rpcheader::rpcheader header;
+    header.set_request_id(request_id);
+    header.set_cancel(true);
+    std::string header_str = header.SerializeAsString();
+    uint32_t header_size_net = htonl(header_str.size());
+    return std::string((char *)&header_size_net, 4) + header_str;
+}
+
+// 调用结束: 先通知controller(执行NotifyOnCancel的回调、移除取消处理函数)，再执行done
+// done可能释放controller，顺序不能颠倒；同步调用done为nullptr
+static void CompleteCall(google::protobuf::RpcController *controller, google::protobuf::Closure *done)
+{
+    MpzrpcController *mpzrpc_controller = dynamic_cast<MpzrpcController *>(controller);
+    if (mpzrpc_controller != nullptr) {
+        mpzrpc_controller->MarkFinished();
+    }
+    if (done) {
+        done->Run();
+    }
+}
+
+// 在conn上发出请求并监视结果，complete在客户端IO线程中恰好执行一次
+// 返回false表示请求没能发出，此时complete不会被执行
+// controller不为空时，请求发出后可以通过它的StartCancel取消
+static bool SendRequest(const spConnection &conn, const google::protobuf::MethodDescriptor *method,
+                        uint64_t request_id, const google::protobuf::Message *request, size_t args_size,
+                        google::protobuf::Message *response, int timeout_ms, MpzrpcController *controller,
+                        CallCompletion complete)
+{
+    // 组装请求帧，这条连接上已经协商过编号的方法只携带method_id
+    // 帧头和参数按算好的长度一次分配，直接序列化到各自的位置
+    std::string frame;
+    uint32_t method_id = conn->getMethodId(method);
+    rpcheader::Priority priority = (controller != nullptr) ? controller->Priority() : rpcheader::PRIORITY_NORMAL;
+    if (method_id != 0 && UseFixedHeader()) {
+        // 请求不需要状态码，status字段用来携带优先级
+        MpzrpcFixedHeader header = {kMpzrpcFixedMagic, kMpzrpcFixedVersion, 0, (uint16_t)priority, method_id, request_id, (uint32_t)args_size, (uint32_t)timeout_ms};
+        frame.resize(kMpzrpcFixedHeaderSize + args_size);
+        MpzrpcEncodeFixedHeader(header, &frame[0]);
+    } else {
+        rpcheader::rpcheader header;
+        if (method_id != 0) {
+            header.set_method_id(method_id);
+        } else {
+            header.set_service_name(method->service()->name());
+            header.set_method_name(method->name());
+        }
+        header.set_args_size(args_size);
+        header.set_request_id(request_id);
+        // 把超时时间告知服务端，排队到超时还没执行的请求服务端不再执行
+        header.set_timeout_ms(timeout_ms);
+        header.set_priority(priority);
+        // 服务端据此在调用方之间公平分配业务线程，固定格式帧沿用同一连接上带过去的身份
+        header.set_tenant(MpzrpcApplication::getApp().getConfig().getRpcTenant());
+        size_t header_size = header.ByteSizeLong();
+        frame.resize(4 + header_size + args_size);
+        uint32_t header_size_net = htonl(header_size);
+        memcpy(&frame[0], &header_size_net, 4);
+        if (!header.SerializeToArray(&frame[4], header_size)) {
+            return false;
+        }
+    }
+    if (!request->SerializeToArray(&frame[frame.size() - args_size], args_size)) {
+        return false;
+    }
+
+    auto call = std::make_shared<InflightCall>();
+    call->response = response;
+    call->complete = std::move(complete);
+
+    // 先启动定时器再登记回调，保证回调中读取timer时它已经被赋值
+    muduo::net::EventLoop *loop = conn->getLoop();
+    std::weak_ptr<MpzrpcClientConnection> weak_conn = conn;
+    call->timer = loop->runAfter(timeout_ms / 1000.0, [call, weak_conn, request_id]() {
+        if (call->finished.exchange(true)) {
+            return;
+        }
+        if (spConnection conn = weak_conn.lock()) {
+            conn->removePending(request_id);
+        }
+        CallOutcome outcome;
+        outcome.retryable = true;
+        outcome.error_text = "rpc call timeout!";
+        call->complete(outcome);
+    });
+
+    bool sent = conn->sendRequest(request_id, std::move(frame),
+        [call, loop, weak_conn, method](bool ok, const rpcheader::rpcresponseheader &header, const char *data) {
+            // 按名字调用的响应带回了方法编号，之后这条连接上的调用都用编号
+            if (ok && header.method_id() != 0) {
+                if (spConnection conn = weak_conn.lock()) {
+                    conn->setMethodId(method, header.method_id());
+                }
+            }
+
+            if (call->finished.exchange(true)) {
+                return;
+            }
+            loop->cancel(call->timer);
+
+            CallOutcome outcome;
+            if (!ok) {
+                outcome.retryable = true;
+                outcome.error_text = "rpc connection closed!";
+            } else if (header.status() == rpcheader::OVERLOADED) {
+                // 请求没有被执行，同步调用可以换节点重试
+                outcome.retryable = true;
+                outcome.error_text = header.error_text().empty() ? "rpc server overloaded!" : header.error_text();
+            } else if (header.status() != rpcheader::OK) {
+                // 服务端已明确给出错误状态，换节点重试也没有意义
+                outcome.error_text = header.error_text().empty() ? "rpc call failed, status: " + std::to_string(header.status())
+                                                                 : header.error_text();
+            } else if (call->response->ParseFromArray(data, header.response_size())) {
+                outcome.success = true;
+            } else {
+                outcome.error_text = "parse response error!";
+            }
+            call->complete(outcome);
+        });
+
+    if (!sent && !call->finished.exchange(true)) {
+        loop->cancel(call->timer);
+        return false;
+    }
+
+    // 取消与响应、超时一样在IO线程中竞争完成权，输掉的一方什么也不做
+    if (controller != nullptr) {
+        controller->SetCancelHandler([call, loop, weak_conn, request_id]() {
+            loop->runInLoop([call, loop, weak_conn, request_id]() {
+                if (call->finished.exchange(true)) {
+                    return;
+                }
+                loop->cancel(call->timer);
+                if (spConnection conn = weak_conn.lock()) {
+                    conn->removePending(request_id);
+                    conn->sendFrame(BuildCancelFrame(request_id));
+                }
+                CallOutcome outcome;
+                outcome.error_text = "rpc call canceled!";
+                call->complete(outcome);
+            });
+        });
+    }
+    // 发送失败前定时器已经触发的情况下，结果已经交给了complete
+    return true;
+}
+
+// 在候选节点中选出一个并发出请求，失败的节点会从hosts中移除
+// 返回发出请求所用的节点，全部失败或已经过了deadline时返回空串
+// 每次发出的请求只带deadline前剩余的时间，重试不会让服务端执行到调用方的截止时间之后
+// allow_create为false时只使用已经建立的连接，不会阻塞在connect上
+static std::string SendToAnyHost(std::vector<std::string> &hosts, int &retries_left,
+                                 const google::protobuf::MethodDescriptor *method,
+                                 uint64_t request_id, const google::protobuf::Message *request, size_t args_size,
+                                 google::protobuf::Message *response, std::chrono::steady_clock::time_point deadline,
+                                 MpzrpcController *controller, const CallCompletion &complete,
+                                 bool allow_create = true)
+{
+    while (retries_left > 0 && !hosts.empty())
+    {
+        --retries_left;
+        std::string host_data = LoadBalancer::getInstance()->selectHost(hosts);
+        if (host_data.empty()) continue;
+
+        int idx = host_data.find(":");
+        spConnection conn_ptr;
+        if (idx != -1) {
+            std::string ip = host_data.substr(0, idx);
+            unsigned short port = atoi(host_data.substr(idx + 1).c_str());
+            conn_ptr = MpzrpcConnectionPool::getInstance()->getConnection(ip, port, allow_create);
+        }
+
+        // 建立连接也会用掉一部分时间，发送前才计算剩余时间
+        int timeout_ms = (int)std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (timeout_ms <= 0) {
+            break;
+        }
+        if (conn_ptr != nullptr && SendRequest(conn_ptr, method, request_id, request, args_size, response, timeout_ms, controller, complete)) {
+            return host_data;
+        }
+        hosts.erase(std::remove(hosts.begin(), hosts.end(), host_data), hosts.end());
+    }
+    return "";
+}
+
+// 客户端IO线程中发起的异步调用(then回调、done中的扇出调用等)需要查询ZK或新建连接时，
+// 整个调用交给后台线程完成，IO线程不阻塞
+// 异步调用约定request在返回前已经序列化，这里复制一份交给后台线程
+static void DeferCall(const google::protobuf::MethodDescriptor *method,
+                      google::protobuf::RpcController *controller,
+                      const google::protobuf::Message *request,
+                      google::protobuf::Message *response,
+                      google::protobuf::Closure *done)
+{
+    std::unique_ptr<google::protobuf::Message> request_copy(request->New());
+    request_copy->CopyFrom(*request);
+    MpzrpcConnectionPool::getInstance()->runBlocking(
+        [method, controller, request_copy = std::move(request_copy), response, done]() {
+            // 后台线程不是IO线程，可以查询ZK和建立连接；异步调用返回前请求已经发出，副本随任务释放
+            MpzrpcChannel channel;
+            channel.CallMethod(method, controller, request_copy.get(), response, done);
+        });
+}
+
 // 清空缓存的静态方法实现
 void MpzrpcChannel::ClearServiceListCache(const std::string& service_path) {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
@@ -38,6 +286,15 @@ void MpzrpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
     std::string method_name = method->name();
     std::string method_path = "/" + service_name + "/" + method_name;
 
+    // 响应和超时定时器都由客户端IO线程处理，在IO线程中同步等待永远等不到结果
+    bool in_io_loop = MpzrpcConnectionPool::getInstance()->isClientLoopThread();
+    if (in_io_loop && done == nullptr) {
+        LOG_ERROR("synchronous rpc call %s on client IO thread, use an asynchronous call instead", method_path.c_str());
+        if (controller) controller->SetFailed("synchronous rpc call on client IO thread would deadlock!");
+        CompleteCall(controller, done);
+        return;
+    }
+
     // 1. 优先从本地缓存获取服务列表
     std::vector<std::string> host_data_list;
     {
@@ -48,7 +305,12 @@ void MpzrpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         }
     }
 
-    // 2. 如果缓存未命中，则从Zookeeper查询
+    // 2. 如果缓存未命中，则从Zookeeper查询，IO线程中发起的调用交给后台线程查询
+    if (host_data_list.empty() && in_io_loop)
+    {
+        DeferCall(method, controller, request, response, done);
+        return;
+    }
     if (host_data_list.empty())
     {
         LOG_INFO("Cache miss for %s, fetching from ZK...", method_path.c_str());
@@ -56,7 +318,7 @@ void MpzrpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         std::vector<std::string> children_nodes = ZkClient::getInstance()->GetChildren(method_path.c_str(), true);
         if (children_nodes.empty()) {
             if (controller) controller->SetFailed(method_path + " has no available provider!");
-            if (done) done->Run();
+            CompleteCall(controller, done);
             return;
         }
         
@@ -80,89 +342,98 @@ void MpzrpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
 
     if (host_data_list.empty()) {
         if (controller) controller->SetFailed(method_path + " failed to get any valid provider data!");
-        if (done) done->Run();
+        CompleteCall(controller, done);
         return;
     }
 
-    // 3. 组装待发送的 RPC 数据
-    std::string args_str;
-    if (!request->SerializeToString(&args_str)) { /* ... */ return; }
-    rpcheader::rpcheader header;
-    header.set_service_name(service_name);
-    header.set_method_name(method_name);
-    header.set_args_size(args_str.size());
-    std::string header_str;
-    if (!header.SerializeToString(&header_str)) { /* ... */ return; }
-    uint32_t header_size = header_str.size();
-    uint32_t header_size_net = htonl(header_size);
-    std::string send_str;
-    send_str.insert(0, std::string((char *)&header_size_net, 4));
-    send_str += header_str + args_str;
-
-    // 4. 重试循环
-    int max_retries = 3;
-    bool rpc_success = false;
-    std::vector<std::string> host_data_list_copy = host_data_list;
+    // 3. 请求在发送时直接序列化进请求帧，这里只计算长度
+    // 同步调用重试时request仍然有效，异步调用在本函数返回前就已发出
+    if (!request->IsInitialized()) {
+        if (controller) controller->SetFailed("serialize request error!");
+        CompleteCall(controller, done);
+        return;
+    }
+    size_t args_size = request->ByteSizeLong();
 
-    for (int i = 0; i < max_retries && !host_data_list_copy.empty(); ++i)
-    {
-        std::string host_data = LoadBalancer::getInstance()->selectHost(host_data_list_copy);
-        if (host_data.empty()) continue;
+    // 调用发出前就已经取消的，直接失败
+    MpzrpcController *cancel_controller = dynamic_cast<MpzrpcController *>(controller);
+    if (cancel_controller != nullptr && cancel_controller->IsCanceled()) {
+        controller->SetFailed("rpc call canceled!");
+        CompleteCall(controller, done);
+        return;
+    }
+    uint64_t request_id = MpzrpcClientConnection::newRequestId();
 
-        int idx = host_data.find(":");
-        if (idx == -1) { 
-            host_data_list_copy.erase(std::remove(host_data_list_copy.begin(), host_data_list_copy.end(), host_data), host_data_list_copy.end());
-            continue; 
-        }
-        std::string ip = host_data.substr(0, idx);
-        unsigned short port = atoi(host_data.substr(idx + 1).c_str());
+    // 整个调用(包括重试)共用一个截止时间
+    int timeout_ms = MpzrpcApplication::getApp().getConfig().getRpcCallTimeout();
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    int retries_left = 3;
+    std::vector<std::string> host_data_list_copy = host_data_list;
 
-        spConnection conn_ptr = MpzrpcConnectionPool::getInstance()->getConnection(ip, port);
-        if (conn_ptr == nullptr) {
-            host_data_list_copy.erase(std::remove(host_data_list_copy.begin(), host_data_list_copy.end(), host_data), host_data_list_copy.end());
-            continue;
+    // 4. 异步调用: 请求发出后立即返回，由客户端IO线程在收到响应或超时时执行done
+    // 请求一旦发出就不再重试；IO线程中只使用已经建立的连接，没有可用连接时交给后台线程新建
+    if (done != nullptr)
+    {
+        CallCompletion complete = [controller, done](const CallOutcome &outcome) {
+            if (!outcome.success && controller) {
+                controller->SetFailed(outcome.error_text);
+            }
+            CompleteCall(controller, done);
+        };
+        if (in_io_loop) {
+            if (SendToAnyHost(host_data_list_copy, retries_left, method, request_id, request, args_size, response, deadline, cancel_controller, complete, false).empty()) {
+                DeferCall(method, controller, request, response, done);
+            }
+            return;
         }
-
-        if (-1 == send(conn_ptr->sockfd, send_str.c_str(), send_str.size(), 0)) {
-            conn_ptr->is_valid = false;
-            host_data_list_copy.erase(std::remove(host_data_list_copy.begin(), host_data_list_copy.end(), host_data), host_data_list_copy.end());
-            continue;
+        if (SendToAnyHost(host_data_list_copy, retries_left, method, request_id, request, args_size, response, deadline, cancel_controller, complete).empty()) {
+            if (controller) controller->SetFailed("RPC call failed after all retries.");
+            CompleteCall(controller, done);
         }
+        return;
+    }
 
-        struct pollfd pfd;
-        pfd.fd = conn_ptr->sockfd;
-        pfd.events = POLLIN;
-        int timeout_ms = MpzrpcApplication::getApp().getConfig().getRpcCallTimeout();
-        int poll_ret = poll(&pfd, 1, timeout_ms);
+    // 5. 同步调用: 调用线程等待结果，超时或连接断开时换节点重试
+    std::string error_text = "RPC call failed after all retries.";
+    bool rpc_success = false;
+    while (true)
+    {
+        struct SyncWaiter
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool finished = false;
+            CallOutcome outcome;
+        };
+        auto waiter = std::make_shared<SyncWaiter>();
+        CallCompletion complete = [waiter](const CallOutcome &outcome) {
+            std::lock_guard<std::mutex> lock(waiter->mutex);
+            waiter->outcome = outcome;
+            waiter->finished = true;
+            waiter->cv.notify_one();
+        };
 
-        if (poll_ret <= 0) {
-            conn_ptr->is_valid = false;
-            host_data_list_copy.erase(std::remove(host_data_list_copy.begin(), host_data_list_copy.end(), host_data), host_data_list_copy.end());
-            continue;
+        std::string host_data = SendToAnyHost(host_data_list_copy, retries_left, method, request_id, request, args_size, response, deadline, cancel_controller, complete);
+        if (host_data.empty()) {
+            break;
         }
 
-        char recv_buf[1024] = {0};
-        int recv_size = recv(conn_ptr->sockfd, recv_buf, 1024, 0);
-        if (recv_size <= 0) {
-            conn_ptr->is_valid = false;
+        // 调用线程不是客户端IO线程(前面已经排除)，定时器保证complete一定会被执行，这里无需再设超时
+        std::unique_lock<std::mutex> lock(waiter->mutex);
+        waiter->cv.wait(lock, [&waiter]() { return waiter->finished; });
+
+        if (waiter->outcome.retryable) {
+            error_text = waiter->outcome.error_text;
             host_data_list_copy.erase(std::remove(host_data_list_copy.begin(), host_data_list_copy.end(), host_data), host_data_list_copy.end());
             continue;
         }
-
-        if (response->ParseFromArray(recv_buf, recv_size)) {
-            rpc_success = true;
-            break;
-        } else {
-            if (controller) controller->SetFailed("parse response error!");
-            break;
-        }
+        rpc_success = waiter->outcome.success;
+        error_text = waiter->outcome.error_text;
+        break;
     }
 
     if (!rpc_success && controller) {
-        controller->SetFailed("RPC call failed after all retries.");
-    }
-    
-    if (done) {
-        done->Run();
+        controller->SetFailed(error_text);
     }
-}
\ No newline at end of file
+    CompleteCall(controller, nullptr);
+}
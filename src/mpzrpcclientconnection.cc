@@ -0,0 +1,240 @@
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mpzrpcclientconnection.h"
+#include "logger.h"
+#include "mpzrpcprotocol.h"
+
+MpzrpcClientConnection::MpzrpcClientConnection(muduo::net::EventLoop *loop, int sockfd, const std::string &host_key, uint32_t max_response_size)
+    : m_loop(loop),
+      m_hostKey(host_key),
+      m_maxResponseSize(max_response_size),
+      m_valid(true),
+      m_pendingCount(0)
+{
+    // muduo要求套接字是非阻塞的
+    int flags = fcntl(sockfd, F_GETFL, 0);
+    fcntl(sockfd, F_SETFL, flags | O_NONBLOCK);
+    fcntl(sockfd, F_SETFD, FD_CLOEXEC);
+
+    struct sockaddr_in local_addr = {};
+    struct sockaddr_in peer_addr = {};
+    socklen_t addrlen = sizeof(local_addr);
+    getsockname(sockfd, (struct sockaddr *)&local_addr, &addrlen);
+    addrlen = sizeof(peer_addr);
+    getpeername(sockfd, (struct sockaddr *)&peer_addr, &addrlen);
+
+    // 套接字交给TcpConnection管理，析构时由它关闭
+    m_conn = std::make_shared<muduo::net::TcpConnection>(m_loop,
+                                                         "RpcClient-" + host_key + "#" + std::to_string(sockfd),
+                                                         sockfd,
+                                                         muduo::net::InetAddress(local_addr),
+                                                         muduo::net::InetAddress(peer_addr));
+}
+
+MpzrpcClientConnection::~MpzrpcClientConnection()
+{
+    m_conn->forceClose();
+}
+
+void MpzrpcClientConnection::start()
+{
+    // 回调中只持有弱引用，连接池丢弃本对象后回调自然失效
+    std::weak_ptr<MpzrpcClientConnection> weak_self = shared_from_this();
+    m_conn->setConnectionCallback([weak_self](const muduo::net::TcpConnectionPtr &conn) {
+        if (auto self = weak_self.lock()) {
+            self->onConnection(conn);
+        }
+    });
+    m_conn->setMessageCallback([weak_self](const muduo::net::TcpConnectionPtr &conn,
+                                           muduo::net::Buffer *buffer,
+                                           muduo::Timestamp receiveTime) {
+        if (auto self = weak_self.lock()) {
+            self->onMessage(conn, buffer, receiveTime);
+        } else {
+            buffer->retrieveAll();
+        }
+    });
+    // 与TcpClient的做法一致，连接关闭后在IO线程中销毁Channel
+    m_conn->setCloseCallback([](const muduo::net::TcpConnectionPtr &conn) {
+        conn->getLoop()->queueInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+    });
+    m_conn->setTcpNoDelay(true);
+    m_loop->runInLoop(std::bind(&muduo::net::TcpConnection::connectEstablished, m_conn));
+}
+
+uint64_t MpzrpcClientConnection::newRequestId()
+{
+    static std::atomic<uint64_t> s_requestId(0);
+    return ++s_requestId;
+}
+
+bool MpzrpcClientConnection::sendRequest(uint64_t request_id, std::string &&frame, ResponseCallback cb)
+{
+    {
+        // 必须先登记再发送，否则响应可能先于登记到达
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        if (!m_valid) {
+            return false;
+        }
+        m_pendingCalls[request_id] = std::move(cb);
+        ++m_pendingCount;
+    }
+    sendFrame(std::move(frame));
+    return true;
+}
+
+void MpzrpcClientConnection::sendFrame(std::string &&frame)
+{
+    // 跨线程时muduo的send会把数据拷贝一份再投递，这里直接把帧移动到IO线程
+    if (m_loop->isInLoopThread()) {
+        m_conn->send(frame);
+    } else {
+        muduo::net::TcpConnectionPtr conn = m_conn;
+        m_loop->runInLoop([conn, frame = std::move(frame)]() { conn->send(frame); });
+    }
+}
+
+void MpzrpcClientConnection::removePending(uint64_t request_id)
+{
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    if (m_pendingCalls.erase(request_id) > 0) {
+        --m_pendingCount;
+    }
+}
+
+uint32_t MpzrpcClientConnection::getMethodId(const google::protobuf::MethodDescriptor *method)
+{
+    std::lock_guard<std::mutex> lock(m_methodIdMutex);
+    auto it = m_methodIds.find(method);
+    return it == m_methodIds.end() ? 0 : it->second;
+}
+
+void MpzrpcClientConnection::setMethodId(const google::protobuf::MethodDescriptor *method, uint32_t method_id)
+{
+    std::lock_guard<std::mutex> lock(m_methodIdMutex);
+    m_methodIds[method] = method_id;
+}
+
+void MpzrpcClientConnection::onConnection(const muduo::net::TcpConnectionPtr &conn)
+{
+    if (!conn->connected())
+    {
+        LOG_INFO("rpc connection to %s closed.", m_hostKey.c_str());
+        failAllPending();
+    }
+}
+
+void MpzrpcClientConnection::onMessage(const muduo::net::TcpConnectionPtr &conn,
+                                       muduo::net::Buffer *buffer,
+                                       muduo::Timestamp receiveTime)
+{
+    // 一次可能收到多个响应帧，也可能只收到半个
+    while (buffer->readableBytes() >= 4)
+    {
+        rpcheader::rpcresponseheader header;
+        uint32_t response_size = 0;
+
+        if ((uint32_t)buffer->peekInt32() == kMpzrpcFixedMagic)
+        {
+            // 固定格式响应帧，转换成rpcresponseheader统一交给回调
+            if (buffer->readableBytes() < kMpzrpcFixedHeaderSize) {
+                break;
+            }
+            MpzrpcFixedHeader fixed_header;
+            if (!MpzrpcDecodeFixedHeader(buffer->peek(), &fixed_header)) {
+                LOG_ERROR("fixed response header error from %s", m_hostKey.c_str());
+                m_valid = false;
+                conn->forceClose();
+                return;
+            }
+            if (fixed_header.body_size > m_maxResponseSize) {
+                LOG_ERROR("invalid response body size: %u from %s", fixed_header.body_size, m_hostKey.c_str());
+                m_valid = false;
+                conn->forceClose();
+                return;
+            }
+            if (buffer->readableBytes() < kMpzrpcFixedHeaderSize + (size_t)fixed_header.body_size) {
+                break;
+            }
+            buffer->retrieve(kMpzrpcFixedHeaderSize);
+
+            header.set_request_id(fixed_header.request_id);
+            header.set_status((rpcheader::StatusCode)fixed_header.status);
+            if (fixed_header.status == rpcheader::OK) {
+                header.set_response_size(fixed_header.body_size);
+            } else {
+                header.set_error_text(buffer->peek(), fixed_header.body_size);
+            }
+            response_size = fixed_header.body_size;
+        }
+        else
+        {
+            uint32_t header_size = buffer->peekInt32();
+            if (header_size > kMaxResponseHeaderSize) {
+                LOG_ERROR("invalid response header size: %u from %s", header_size, m_hostKey.c_str());
+                m_valid = false;
+                conn->forceClose();
+                return;
+            }
+            if (buffer->readableBytes() < 4 + header_size) {
+                break;
+            }
+
+            if (!header.ParseFromArray(buffer->peek() + 4, header_size)) {
+                LOG_ERROR("response header parse error from %s", m_hostKey.c_str());
+                m_valid = false;
+                conn->forceClose();
+                return;
+            }
+
+            // 过大的response_size会让总长度回绕，解析时长度变为负数，直接断开连接
+            response_size = header.response_size();
+            if (response_size > m_maxResponseSize) {
+                LOG_ERROR("invalid response size: %u from %s", response_size, m_hostKey.c_str());
+                m_valid = false;
+                conn->forceClose();
+                return;
+            }
+            if (buffer->readableBytes() < 4 + (size_t)header_size + response_size) {
+                break;
+            }
+            buffer->retrieve(4 + header_size);
+        }
+
+        ResponseCallback cb;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            auto it = m_pendingCalls.find(header.request_id());
+            if (it != m_pendingCalls.end()) {
+                cb = std::move(it->second);
+                m_pendingCalls.erase(it);
+                --m_pendingCount;
+            }
+        }
+
+        // 找不到说明调用方已经超时放弃，直接丢弃
+        if (cb) {
+            cb(true, header, buffer->peek());
+        }
+        buffer->retrieve(response_size);
+    }
+}
+
+void MpzrpcClientConnection::failAllPending()
+{
+    std::unordered_map<uint64_t, ResponseCallback> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_valid = false;
+        pending.swap(m_pendingCalls);
+        m_pendingCount = 0;
+    }
+
+    rpcheader::rpcresponseheader empty_header;
+    for (auto &call : pending) {
+        call.second(false, empty_header, nullptr);
+    }
+}
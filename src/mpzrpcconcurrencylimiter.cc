@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cmath>
+
+#include "mpzrpcconcurrencylimiter.h"
+
+MpzrpcConcurrencyLimiter::MpzrpcConcurrencyLimiter(int min_limit, int max_limit, int probe_interval_s)
+    : m_minLimit(std::max(1, min_limit)),
+      m_maxLimit(std::max(std::max(1, min_limit), max_limit)),
+      m_probeInterval(std::chrono::seconds(std::max(0, probe_interval_s))),
+      m_rng(std::random_device{}())
+{
+    // 启动时从最小值开始，直接以第一个窗口的耗时作为基准，不需要先排空积压的请求
+    m_limit = m_minLimit;
+    m_probeSavedLimit = m_limit;
+    scheduleProbe();
+}
+
+bool MpzrpcConcurrencyLimiter::tryAcquire()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_inflight >= (int)m_limit) {
+        return false;
+    }
+    ++m_inflight;
+    m_windowMaxInflight = std::max(m_windowMaxInflight, m_inflight);
+    return true;
+}
+
+void MpzrpcConcurrencyLimiter::release(int64_t rtt_us, bool sampled)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_inflight;
+    if (!sampled) {
+        return;
+    }
+
+    m_windowRttSumUs += std::max<int64_t>(rtt_us, 1);
+    ++m_windowSamples;
+    if (m_windowSamples >= windowSize()) {
+        update(m_windowRttSumUs / m_windowSamples);
+        m_windowRttSumUs = 0;
+        m_windowSamples = 0;
+        m_windowMaxInflight = m_inflight;
+    }
+}
+
+int MpzrpcConcurrencyLimiter::windowSize() const
+{
+    // 排空阶段要等上限降低前接收的请求都结束，按原来的上限计算
+    double limit = (m_probeState == kProbeDraining) ? m_probeSavedLimit : m_limit;
+    return std::max(kMinWindowSamples, (int)limit);
+}
+
+void MpzrpcConcurrencyLimiter::scheduleProbe()
+{
+    if (m_probeInterval.count() == 0) {
+        m_nextProbe = Clock::time_point::max();
+        return;
+    }
+    int64_t interval_ms = m_probeInterval.count();
+    std::uniform_int_distribution<int64_t> jitter(-interval_ms / 4, interval_ms / 4);
+    m_nextProbe = Clock::now() + std::chrono::milliseconds(interval_ms + jitter(m_rng));
+}
+
+void MpzrpcConcurrencyLimiter::update(int64_t rtt_us)
+{
+    if (m_probeState == kProbeDraining) {
+        m_probeState = kProbeMeasuring;
+        return;
+    }
+    if (m_probeState == kProbeMeasuring) {
+        m_minRttUs = rtt_us;
+        m_limit = m_probeSavedLimit;
+        m_probeState = kProbeNone;
+        scheduleProbe();
+        return;
+    }
+
+    m_minRttUs = std::min(m_minRttUs, rtt_us);
+
+    // 耗时是基准的两倍以上时上限最多减半，避免一次抖动把上限压得过低
+    double gradient = std::max(0.5, std::min(1.0, (double)m_minRttUs / rtt_us));
+    double new_limit = m_limit * gradient + std::sqrt(m_limit);
+
+    // 请求量本身不足以用满上限时，耗时不能说明上限是否合适，不再提高上限
+    if (m_windowMaxInflight < m_limit / 2) {
+        new_limit = std::min(new_limit, m_limit);
+    }
+
+    // 平滑调整，避免上限随单个窗口大幅波动
+    m_limit = m_limit * 0.8 + new_limit * 0.2;
+    m_limit = std::max((double)m_minLimit, std::min((double)m_maxLimit, m_limit));
+
+    // 定期重新测量基准，处理函数的耗时变化后基准能够跟上
+    if (Clock::now() >= m_nextProbe) {
+        m_probeSavedLimit = m_limit;
+        m_limit = m_minLimit;
+        m_probeState = kProbeDraining;
+    }
+}
+
+int MpzrpcConcurrencyLimiter::limit() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (int)m_limit;
+}
+
+int MpzrpcConcurrencyLimiter::inflight() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inflight;
+}
@@ -88,4 +88,187 @@ void MpzrpcConfig::LoadConfigFromFile(const std::string &config_file)
     { 
         m_poolTimeout = 1000; 
     }
+
+    if (j.find("poolmaxpending") != j.end()) 
+    { 
+        m_poolMaxPending = j["poolmaxpending"]; 
+    }
+    else 
+    { 
+        m_poolMaxPending = 64; 
+    }
+
+    // 读取可选的客户端IO线程数量配置
+    if (j.find("clientthreadnum") != j.end()) 
+    { 
+        m_clientThreadNum = j["clientthreadnum"]; 
+    }
+    else 
+    { 
+        m_clientThreadNum = 1; 
+    }
+
+    // 读取可选的请求帧头格式配置，固定格式需要服务端同样支持
+    if (j.find("rpcheaderformat") != j.end()) 
+    { 
+        m_rpcHeaderFormat = j["rpcheaderformat"]; 
+    }
+    else 
+    { 
+        m_rpcHeaderFormat = "protobuf"; 
+    }
+
+    // 读取可选的业务线程池类型配置: "simple" 为单队列线程池，"workstealing" 为工作窃取线程池
+    if (j.find("businessthreadpool") != j.end()) 
+    { 
+        m_businessThreadPool = j["businessthreadpool"]; 
+    }
+    else 
+    { 
+        m_businessThreadPool = "simple"; 
+    }
+
+    // 读取可选的业务队列长度上限，0表示不限制
+    if (j.find("maxqueuedcalls") != j.end()) 
+    { 
+        m_maxQueuedCalls = j["maxqueuedcalls"]; 
+    }
+    else 
+    { 
+        m_maxQueuedCalls = 0; 
+    }
+
+    // 读取可选的请求最长排队时间，0表示不限制
+    if (j.find("maxqueuewaitms") != j.end()) 
+    { 
+        m_maxQueueWaitMs = j["maxqueuewaitms"]; 
+    }
+    else 
+    { 
+        m_maxQueueWaitMs = 0; 
+    }
+
+    // 读取可选的服务端运行模式: "pool" 交给业务线程池执行，"shard" 每个IO线程绑定一个核并直接执行
+    if (j.find("providermode") != j.end()) 
+    { 
+        m_providerMode = j["providermode"]; 
+    }
+    else 
+    { 
+        m_providerMode = "pool"; 
+    }
+
+    // 读取可选的独立业务线程池配置，如 "threadpools": {"slow": {"threadnum": 2, "maxqueuedcalls": 100}}
+    if (j.find("threadpools") != j.end()) 
+    { 
+        nlohmann::json &pools = j["threadpools"];
+        for (auto it = pools.begin(); it != pools.end(); ++it) 
+        {
+            MpzrpcPoolConfig pool_config;
+            nlohmann::json &pool = it.value();
+            pool_config.threadNum = pool.find("threadnum") != pool.end() ? pool["threadnum"].get<int>() : 1;
+            pool_config.maxQueuedCalls = pool.find("maxqueuedcalls") != pool.end() ? pool["maxqueuedcalls"].get<int>() : 0;
+            m_threadPools[it.key()] = pool_config;
+        }
+    }
+
+    // 读取可选的方法到线程池的分配，键为 "服务名" 或 "服务名.方法名"
+    if (j.find("methodpools") != j.end()) 
+    { 
+        nlohmann::json &methods = j["methodpools"];
+        for (auto it = methods.begin(); it != methods.end(); ++it) 
+        {
+            m_methodPools[it.key()] = it.value().get<std::string>();
+        }
+    }
+
+    // 读取可选的调度队列统计日志间隔(秒)，0表示不输出
+    if (j.find("schedulerstatsinterval") != j.end()) 
+    { 
+        m_schedulerStatsInterval = j["schedulerstatsinterval"]; 
+    }
+    else 
+    { 
+        m_schedulerStatsInterval = 0; 
+    }
+
+    // 读取可选的调用方身份，为空时服务端按本机IP区分调用方
+    if (j.find("rpctenant") != j.end()) 
+    { 
+        m_rpcTenant = j["rpctenant"]; 
+    }
+    else 
+    { 
+        m_rpcTenant = ""; 
+    }
+
+    // 读取可选的调用方每轮调度额度(微秒)
+    if (j.find("tenantquantumus") != j.end()) 
+    { 
+        m_tenantQuantumUs = j["tenantquantumus"]; 
+    }
+    else 
+    { 
+        m_tenantQuantumUs = 1000; 
+    }
+
+    // 读取可选的自适应并发限制开关，开启后各业务线程池按请求耗时自动调整在途请求数上限
+    if (j.find("adaptivelimit") != j.end()) 
+    { 
+        m_adaptiveLimit = j["adaptivelimit"]; 
+    }
+    else 
+    { 
+        m_adaptiveLimit = false; 
+    }
+
+    // 读取可选的自适应并发上限的最大值
+    if (j.find("adaptivelimitmax") != j.end()) 
+    { 
+        m_adaptiveLimitMax = j["adaptivelimitmax"]; 
+    }
+    else 
+    { 
+        m_adaptiveLimitMax = 1000; 
+    }
+
+    // 读取可选的自适应并发上限的最小值，重新测量基准时上限也只降到这里，0表示取线程数的两倍
+    if (j.find("adaptivelimitmin") != j.end()) 
+    { 
+        m_adaptiveLimitMin = j["adaptivelimitmin"]; 
+    }
+    else 
+    { 
+        m_adaptiveLimitMin = 0; 
+    }
+
+    // 读取可选的自适应并发限制重新测量基准的平均间隔(秒)
+    if (j.find("adaptivelimitprobeinterval") != j.end()) 
+    { 
+        m_adaptiveLimitProbeInterval = j["adaptivelimitprobeinterval"]; 
+    }
+    else 
+    { 
+        m_adaptiveLimitProbeInterval = 30; 
+    }
+
+    // 读取可选的请求体长度上限(字节)，超过时服务端断开连接
+    if (j.find("maxrequestsize") != j.end()) 
+    { 
+        m_maxRequestSize = j["maxrequestsize"]; 
+    }
+    else 
+    { 
+        m_maxRequestSize = 64 * 1024 * 1024; 
+    }
+
+    // 读取可选的响应体长度上限(字节)，超过时客户端断开连接
+    if (j.find("maxresponsesize") != j.end()) 
+    { 
+        m_maxResponseSize = j["maxresponsesize"]; 
+    }
+    else 
+    { 
+        m_maxResponseSize = 64 * 1024 * 1024; 
+    }
 }
\ No newline at end of file
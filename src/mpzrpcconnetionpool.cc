@@ -2,9 +2,15 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
-#include <iostream>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <climits>
+#include <algorithm>
+#include <string>
 
 #include "mpzrpcconnectionpool.h"
+#include "logger.h"
 
 MpzrpcConnectionPool* MpzrpcConnectionPool::getInstance()
 {
@@ -12,126 +18,150 @@ MpzrpcConnectionPool* MpzrpcConnectionPool::getInstance()
     return &pool;
 }
 
-MpzrpcConnectionPool::MpzrpcConnectionPool() 
+MpzrpcConnectionPool::MpzrpcConnectionPool() : m_nextLoop(0), m_blockingPool(1)
 {
     loadConfig();
+    for (int i = 0; i < m_clientThreadNum; ++i)
+    {
+        m_loopThreads.emplace_back(new muduo::net::EventLoopThread(muduo::net::EventLoopThread::ThreadInitCallback(),
+                                                                   "RpcClientLoop" + std::to_string(i)));
+        m_loops.push_back(m_loopThreads.back()->startLoop());
+    }
 }
 
 MpzrpcConnectionPool::~MpzrpcConnectionPool()
 {
+    // 连接对象析构时会关闭连接，IO线程随m_loopThreads析构退出
     std::lock_guard<std::mutex> lock(m_mapMutex);
-    for (auto& pair : m_connectionMap)
-    {
-        auto& queue = pair.second;
-        while (!queue.empty())
-        {
-            int fd = queue.front();
-            queue.pop();
-            close(fd);
-        }
-    }
+    m_connectionMap.clear();
 }
 
 void MpzrpcConnectionPool::loadConfig() {
     m_initSize = MpzrpcApplication::getApp().getConfig().getPoolInitSize();
     m_maxSize = MpzrpcApplication::getApp().getConfig().getPoolMaxSize();
+    m_maxPending = MpzrpcApplication::getApp().getConfig().getPoolMaxPending();
     m_poolTimeout = MpzrpcApplication::getApp().getConfig().getPoolTimeout();
+    // 响应体长度的上限，不超过ParseFromArray能接受的int范围
+    int maxResponseSize = MpzrpcApplication::getApp().getConfig().getMaxResponseSize();
+    m_maxResponseSize = (maxResponseSize > 0) ? (uint32_t)maxResponseSize : (uint32_t)INT_MAX;
+    m_clientThreadNum = std::max(1, MpzrpcApplication::getApp().getConfig().getClientThreadNum());
+}
+
+bool MpzrpcConnectionPool::isClientLoopThread() const
+{
+    for (muduo::net::EventLoop *loop : m_loops) {
+        if (loop->isInLoopThread()) {
+            return true;
+        }
+    }
+    return false;
 }
 
-int MpzrpcConnectionPool::createConnection(std::string ip, unsigned short port)
+void MpzrpcConnectionPool::runBlocking(Task task)
+{
+    m_blockingPool.post(std::move(task));
+}
+
+muduo::net::EventLoop* MpzrpcConnectionPool::getNextLoop()
+{
+    return m_loops[m_nextLoop++ % m_loops.size()];
+}
+
+spConnection MpzrpcConnectionPool::createConnection(const std::string& ip, unsigned short port, const std::string& host_key)
 {
     int clientfd = socket(AF_INET, SOCK_STREAM, 0);
-    if (clientfd == -1) return -1;
+    if (clientfd == -1) return nullptr;
     struct sockaddr_in server_addr;
     server_addr.sin_family = AF_INET;
     server_addr.sin_port = htons(port);
     server_addr.sin_addr.s_addr = inet_addr(ip.c_str());
+
+    // 非阻塞connect，用poll等待pooltimeout毫秒
+    int flags = fcntl(clientfd, F_GETFL, 0);
+    fcntl(clientfd, F_SETFL, flags | O_NONBLOCK);
     if (connect(clientfd, (struct sockaddr *)&server_addr, sizeof(server_addr)) == -1) {
-        close(clientfd);
-        return -1;
+        if (errno != EINPROGRESS) {
+            close(clientfd);
+            return nullptr;
+        }
+        struct pollfd pfd;
+        pfd.fd = clientfd;
+        pfd.events = POLLOUT;
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (poll(&pfd, 1, m_poolTimeout) <= 0 ||
+            getsockopt(clientfd, SOL_SOCKET, SO_ERROR, &err, &len) == -1 || err != 0) {
+            LOG_ERROR("connect to %s failed!", host_key.c_str());
+            close(clientfd);
+            return nullptr;
+        }
     }
-    return clientfd;
-}
 
-void MpzrpcConnectionPool::returnConnection(const std::string& host, int sockfd)
-{
-    if (sockfd != -1) {
-        std::lock_guard<std::mutex> lock(m_mapMutex);
-        m_connectionMap[host].push(sockfd);
-        m_cv.notify_one();
-    }
+    spConnection conn = std::make_shared<MpzrpcClientConnection>(getNextLoop(), clientfd, host_key, m_maxResponseSize);
+    conn->start();
+    return conn;
 }
 
-spConnection MpzrpcConnectionPool::getConnection(std::string ip, unsigned short port)
+spConnection MpzrpcConnectionPool::getConnection(std::string ip, unsigned short port, bool allow_create)
 {
     std::string host_key = ip + ":" + std::to_string(port);
     std::unique_lock<std::mutex> lock(m_mapMutex);
+    HostConnections& host = m_connectionMap[host_key];
+    spConnection best;
 
-    // 首次请求该主机，初始化连接计数器和初始连接
-    if (m_connectionCountMap.find(host_key) == m_connectionCountMap.end()) {
-        m_connectionCountMap[host_key] = 0;
-        for (int i = 0; i < m_initSize; ++i) {
-            int sockfd = createConnection(ip, port);
-            if (sockfd != -1) {
-                m_connectionMap[host_key].push(sockfd);
-                m_connectionCountMap[host_key]++;
+    for (;;)
+    {
+        // 剔除已经断开的连接
+        std::vector<spConnection>& conns = host.conns;
+        conns.erase(std::remove_if(conns.begin(), conns.end(),
+                                   [](const spConnection& conn) { return !conn->isValid(); }),
+                    conns.end());
+
+        // 选择在途请求最少的连接
+        best = nullptr;
+        for (const spConnection& conn : conns) {
+            if (best == nullptr || conn->pendingCount() < best->pendingCount()) {
+                best = conn;
             }
         }
-    }
 
-    // 用一个循环来处理所有情况
-    while(true) {
-        // 条件1: 池中有可用连接
-        if (!m_connectionMap[host_key].empty()) {
-            int sockfd = m_connectionMap[host_key].front();
-            m_connectionMap[host_key].pop();
-            lock.unlock();
-
-            return std::shared_ptr<PooledConnection>(new PooledConnection{sockfd, true, host_key}, 
-                [this](PooledConnection* conn){
-                    if (conn->is_valid) {
-                        this->returnConnection(conn->host_key, conn->sockfd);
-                    } else {
-                        close(conn->sockfd);
-                        std::lock_guard<std::mutex> lock(m_mapMutex);
-                        m_connectionCountMap[conn->host_key]--;
-                    }
-                    delete conn;
-                });
+        // 最空闲的连接也已经很忙，且未达到最大连接数时，新建一条连接
+        if (best != nullptr && ((int)best->pendingCount() < m_maxPending || (int)conns.size() >= m_maxSize)) {
+            return best;
         }
-
-        // 条件2: 池中无连接，但未达到最大连接数
-        if (m_connectionCountMap[host_key].load() < m_maxSize) {
-            lock.unlock(); // 解锁去创建连接
-            int sockfd = createConnection(ip, port);
-            lock.lock(); // 重新加锁以更新计数器
-
-            if (sockfd != -1) {
-                m_connectionCountMap[host_key]++;
-                return std::shared_ptr<PooledConnection>(new PooledConnection{sockfd, true, host_key}, 
-                    [this](PooledConnection* conn){
-                        if (conn->is_valid) {
-                            this->returnConnection(conn->host_key, conn->sockfd);
-                        } else {
-                            close(conn->sockfd);
-                            std::lock_guard<std::mutex> lock(m_mapMutex);
-                            m_connectionCountMap[conn->host_key]--;
-                        }
-                        delete conn;
-                    });
-            } else {
-                return nullptr; // 创建失败
-            }
+        if (!allow_create) {
+            return best;
         }
-        
-        // 条件3: 池中无连接，且已达到最大连接数，必须等待
-        if (m_cv.wait_for(lock, std::chrono::milliseconds(m_poolTimeout)) == std::cv_status::timeout) {
-            // 等待超时后，再次检查队列是否为空
-            if (m_connectionMap[host_key].empty()) {
-                std::cerr << "Get connection timeout... fail!" << std::endl;
-                return nullptr;
-            }
+        if (!host.creating) {
+            break;
+        }
+        // 其他线程正在建立连接: 已有连接时先用着，否则等它建立完成
+        if (best != nullptr) {
+            return best;
+        }
+        m_createdCond.wait(lock);
+    }
+
+    // 首次请求该主机时建立初始连接，否则新建一条
+    int count = host.conns.empty() ? std::max(1, m_initSize) : 1;
+    host.creating = true;
+    lock.unlock(); // 解锁去创建连接，connect最多阻塞pooltimeout
+    std::vector<spConnection> created;
+    for (int i = 0; i < count; ++i) {
+        spConnection conn = createConnection(ip, port, host_key);
+        if (conn != nullptr) {
+            created.push_back(conn);
         }
-        // 如果被notify唤醒，循环会继续，并在下一次迭代时从条件1中获取连接
     }
-}
\ No newline at end of file
+    lock.lock();
+
+    // unordered_map的元素不会因插入而移动，host仍然有效
+    host.creating = false;
+    host.conns.insert(host.conns.end(), created.begin(), created.end());
+    m_createdCond.notify_all();
+
+    if (created.empty()) {
+        return best; // 创建失败时退回到已有连接，没有则返回nullptr
+    }
+    return created.front();
+}
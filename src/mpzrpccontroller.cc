@@ -4,12 +4,22 @@ MpzrpcController::MpzrpcController()
 {
     m_failed = false;
     m_errText = "";
+    m_canceled = false;
+    m_finished = false;
+    m_cancelCallback = nullptr;
+    m_priority = rpcheader::PRIORITY_NORMAL;
 }
 
 void MpzrpcController::Reset()
 {
     m_failed = false;
     m_errText = "";
+    m_priority = rpcheader::PRIORITY_NORMAL;
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    m_canceled = false;
+    m_finished = false;
+    m_cancelHandler = nullptr;
+    m_cancelCallback = nullptr;
 }
 
 bool MpzrpcController::Failed() const
@@ -28,7 +38,83 @@ void MpzrpcController::SetFailed(const std::string &reason)
     m_errText = reason;
 }
 
-// 目前未实现具体的功能
-void MpzrpcController::StartCancel() {}
-bool MpzrpcController::IsCanceled() const { return false; }
-void MpzrpcController::NotifyOnCancel(google::protobuf::Closure *callback) {}
\ No newline at end of file
+void MpzrpcController::StartCancel()
+{
+    std::function<void()> handler;
+    google::protobuf::Closure *callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        // 已经结束的调用没有可以取消的请求，NotifyOnCancel的回调也已经执行过
+        if (m_canceled || m_finished) {
+            return;
+        }
+        m_canceled = true;
+        handler.swap(m_cancelHandler);
+        callback = m_cancelCallback;
+        m_cancelCallback = nullptr;
+    }
+    // handler会结束调用并执行done，不能在持有锁时执行
+    if (handler) {
+        handler();
+    }
+    if (callback != nullptr) {
+        callback->Run();
+    }
+}
+
+bool MpzrpcController::IsCanceled() const
+{
+    return m_canceled;
+}
+
+void MpzrpcController::NotifyOnCancel(google::protobuf::Closure *callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if (!m_canceled && !m_finished) {
+            m_cancelCallback = callback;
+            return;
+        }
+    }
+    callback->Run();
+}
+
+void MpzrpcController::MarkFinished()
+{
+    std::function<void()> handler;
+    google::protobuf::Closure *callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        m_finished = true;
+        handler.swap(m_cancelHandler);
+        callback = m_cancelCallback;
+        m_cancelCallback = nullptr;
+    }
+    // handler在锁外析构，它持有的连接等资源不在锁内释放
+    handler = nullptr;
+    if (callback != nullptr) {
+        callback->Run();
+    }
+}
+
+void MpzrpcController::SetCancelHandler(std::function<void()> handler)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if (!m_canceled) {
+            m_cancelHandler = std::move(handler);
+            return;
+        }
+    }
+    handler();
+}
+
+void MpzrpcController::SetPriority(rpcheader::Priority priority)
+{
+    m_priority = priority;
+}
+
+rpcheader::Priority MpzrpcController::Priority() const
+{
+    return m_priority;
+}
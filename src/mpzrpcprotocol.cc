@@ -0,0 +1,55 @@
+#include <arpa/inet.h>
+#include <endian.h>
+#include <string.h>
+
+#include "mpzrpcprotocol.h"
+
+// 帧头各字段的偏移
+// | magic 4 | version 1 | flags 1 | status 2 | method_id 4 | request_id 8 | body_size 4 | timeout_ms 4 |
+void MpzrpcEncodeFixedHeader(const MpzrpcFixedHeader &header, char *buf)
+{
+    uint32_t magic = htonl(header.magic);
+    uint16_t status = htons(header.status);
+    uint32_t method_id = htonl(header.method_id);
+    uint64_t request_id = htobe64(header.request_id);
+    uint32_t body_size = htonl(header.body_size);
+    uint32_t timeout_ms = htonl(header.timeout_ms);
+
+    memcpy(buf, &magic, 4);
+    buf[4] = (char)header.version;
+    buf[5] = (char)header.flags;
+    memcpy(buf + 6, &status, 2);
+    memcpy(buf + 8, &method_id, 4);
+    memcpy(buf + 12, &request_id, 8);
+    memcpy(buf + 20, &body_size, 4);
+    memcpy(buf + 24, &timeout_ms, 4);
+}
+
+bool MpzrpcDecodeFixedHeader(const char *buf, MpzrpcFixedHeader *header)
+{
+    uint32_t magic;
+    memcpy(&magic, buf, 4);
+    header->magic = ntohl(magic);
+    header->version = (uint8_t)buf[4];
+    if (header->magic != kMpzrpcFixedMagic || header->version != kMpzrpcFixedVersion) {
+        return false;
+    }
+    header->flags = (uint8_t)buf[5];
+
+    uint16_t status;
+    uint32_t method_id;
+    uint64_t request_id;
+    uint32_t body_size;
+    uint32_t timeout_ms;
+    memcpy(&status, buf + 6, 2);
+    memcpy(&method_id, buf + 8, 4);
+    memcpy(&request_id, buf + 12, 8);
+    memcpy(&body_size, buf + 20, 4);
+    memcpy(&timeout_ms, buf + 24, 4);
+    header->status = ntohs(status);
+    header->method_id = ntohl(method_id);
+    header->request_id = be64toh(request_id);
+    header->body_size = ntohl(body_size);
+    header->timeout_ms = ntohl(timeout_ms);
+    return true;
+}
@@ -1,4 +1,9 @@
 #include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include <thread>
+#include <algorithm>
 #include <functional>
 
 #include "mpzrpcprovider.h"
@@ -7,6 +12,21 @@
 #include "logger.h"
 #include "zookeeperutil.h"
 #include "threadpool.h"
+#include "workstealingthreadpool.h"
+#include "mpzrpcprotocol.h"
+#include "mpzrpccoroutine.h"
+
+// 把当前线程绑定到指定的核上
+static void PinCurrentThread(int core)
+{
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+    if (ret != 0) {
+        LOG_ERROR("pin thread to core %d error: %d", core, ret);
+    }
+}
 
 // 构造函数定义
 MpzrpcProvider::MpzrpcProvider() {}
@@ -19,7 +39,6 @@ void MpzrpcProvider::run()
     std::string ip = MpzrpcApplication::getApp().getConfig().getRpcServerIp();
     uint16_t port = MpzrpcApplication::getApp().getConfig().getRpcServerPort();
     int muduoThreadum = MpzrpcApplication::getApp().getConfig().getMuduoThreadNum();
-    int businessThreadNum = MpzrpcApplication::getApp().getConfig().getBusinessThreadNum();
 
     // 创建TcpServer对象
     muduo::net::InetAddress address(ip, port);
@@ -30,11 +49,54 @@ void MpzrpcProvider::run()
     server.setConnectionCallback(std::bind(&MpzrpcProvider::onConnectionCallback, this, std::placeholders::_1));
     server.setMessageCallback(std::bind(&MpzrpcProvider::onMessageCallback, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
     
+    // 分片模式: 每个IO线程绑定一个核，独立完成解析、执行和回复，没有共享的业务队列
+    // 连接由muduo轮询分配给各个IO线程，之后这条连接上的请求始终在同一个核上处理
+    m_shardMode = MpzrpcApplication::getApp().getConfig().getProviderMode() == "shard";
+    int coreCount = std::max(1u, std::thread::hardware_concurrency());
+    if (m_shardMode && muduoThreadum <= 0) {
+        muduoThreadum = coreCount;
+    }
+
     // 设置muduo的I/O线程数量
     server.setThreadNum(muduoThreadum);
 
-    // 初始化业务线程池
-    m_threadPool = std::make_unique<ThreadPool>(businessThreadNum);
+    // 初始化业务线程池，分片模式不需要业务线程池
+    if (!m_shardMode) {
+        CreateBusinessPools();
+    }
+
+    // 业务队列的过载保护
+    m_maxQueueWaitMs = MpzrpcApplication::getApp().getConfig().getMaxQueueWaitMs();
+
+    // 请求体长度的上限，不超过ParseFromArray能接受的int范围
+    int maxRequestSize = MpzrpcApplication::getApp().getConfig().getMaxRequestSize();
+    m_maxRequestSize = (maxRequestSize > 0) ? (uint32_t)maxRequestSize : (uint32_t)INT_MAX;
+
+    // 定期输出各优先级的排队情况和排队的调用方数
+    int statsInterval = MpzrpcApplication::getApp().getConfig().getSchedulerStatsInterval();
+    if (!m_shardMode && statsInterval > 0) {
+        loop.runEvery(statsInterval, std::bind(&MpzrpcProvider::LogSchedulerStats, this));
+    }
+
+    // 调度队列中调用方的状态一直保留，定期清理长时间空闲的调用方
+    if (!m_shardMode) {
+        loop.runEvery(kTenantExpireSeconds, std::bind(&MpzrpcProvider::ExpireIdleTenants, this));
+    }
+
+    // 过载时被丢弃的请求只计数，由定时器汇总输出
+    loop.runEvery(kDropLogSeconds, std::bind(&MpzrpcProvider::LogDroppedCalls, this));
+
+    // IO线程中直接执行的协程处理函数co_await后回到原来的IO线程继续执行
+    // run()直到服务停止才返回，回调中可以引用nextCore
+    std::atomic_int nextCore(0);
+    server.setThreadInitCallback([this, &nextCore, coreCount](muduo::net::EventLoop *io_loop) {
+        if (m_shardMode) {
+            PinCurrentThread(nextCore++ % coreCount);
+        }
+        thread_local MpzrpcResumeExecutor loop_executor;
+        loop_executor = [io_loop](std::function<void()> resume) { io_loop->runInLoop(std::move(resume)); };
+        mpzrpcCurrentResumeExecutor() = &loop_executor;
+    });
 
     // Zookeeper服务注册
     for (auto &sp : m_servicemap)
@@ -66,28 +128,224 @@ void MpzrpcProvider::run()
     loop.loop();
 }
 
+void MpzrpcProvider::CreateBusinessPools()
+{
+    const MpzrpcConfig &config = MpzrpcApplication::getApp().getConfig();
+
+    // 默认线程池 + addThreadPool定义的 + 配置文件定义的，同名时后者优先
+    std::unordered_map<std::string, MpzrpcPoolConfig> pool_configs = m_poolConfigs;
+    for (auto &item : config.getThreadPools()) {
+        pool_configs[item.first] = item.second;
+    }
+    // 默认线程池只由businessthreadnum和maxqueuedcalls配置
+    if (pool_configs.count("default") > 0) {
+        LOG_ERROR("thread pool:[default] is defined by businessthreadnum and maxqueuedcalls, the threadpools/addThreadPool definition is ignored");
+    }
+    pool_configs["default"] = {config.getBusinessThreadNum(), config.getMaxQueuedCalls()};
+
+    // 业务线程较多时工作窃取线程池可以避免争抢同一个队列锁
+    bool work_stealing = config.getBusinessThreadPool() == "workstealing";
+    for (auto &item : pool_configs) {
+        // 没有线程的线程池只会接收请求而永远不执行，两种线程池都至少创建一个线程
+        int thread_num = item.second.threadNum;
+        if (thread_num <= 0) {
+            LOG_ERROR("thread pool:[%s] threadnum %d is invalid, use 1 thread", item.first.c_str(), thread_num);
+            thread_num = 1;
+        }
+        std::unique_ptr<BusinessPool> pool = std::make_unique<BusinessPool>(item.first, item.second.maxQueuedCalls, config.getTenantQuantumUs());
+        // 在途请求包括排队的请求，上限不低于线程池平时就能消化的量:
+        // 未配置时取线程数的两倍，即所有业务线程都在执行、每个线程后面再排一个请求
+        if (config.getAdaptiveLimit()) {
+            int min_limit = config.getAdaptiveLimitMin();
+            if (min_limit <= 0) {
+                min_limit = thread_num * 2;
+            }
+            pool->limiter = std::make_unique<MpzrpcConcurrencyLimiter>(min_limit, config.getAdaptiveLimitMax(), config.getAdaptiveLimitProbeInterval());
+        }
+        if (work_stealing) {
+            pool->executor = std::make_unique<WorkStealingThreadPool>(thread_num);
+        } else {
+            pool->executor = std::make_unique<ThreadPool>(thread_num);
+        }
+
+        // 协程处理函数co_await下游RPC后，通过它回到本线程池继续执行
+        BusinessPool *raw_pool = pool.get();
+        pool->resume_executor = [raw_pool](std::function<void()> resume) {
+            raw_pool->executor->post([raw_pool, resume]() {
+                mpzrpcCurrentResumeExecutor() = &raw_pool->resume_executor;
+                resume();
+            });
+        };
+        m_pools[item.first] = std::move(pool);
+    }
+
+    // 为每个方法确定线程池: 配置文件中的 "服务名.方法名" > "服务名" > publishService指定 > 默认
+    BusinessPool *default_pool = m_pools["default"].get();
+    const std::unordered_map<std::string, std::string> &method_pools = config.getMethodPools();
+    for (MethodInfo &info : m_methodTable)
+    {
+        const std::string &service_name = info.m_method->service()->name();
+        std::string pool_name = info.m_poolName;
+        auto it = method_pools.find(service_name + "." + info.m_method->name());
+        if (it == method_pools.end()) {
+            it = method_pools.find(service_name);
+        }
+        if (it != method_pools.end()) {
+            pool_name = it->second;
+        }
+
+        info.m_pool = default_pool;
+        if (!pool_name.empty()) {
+            auto pool_it = m_pools.find(pool_name);
+            if (pool_it != m_pools.end()) {
+                info.m_pool = pool_it->second.get();
+            } else {
+                LOG_ERROR("thread pool:[%s] is not defined, method:[%s] uses the default pool", pool_name.c_str(), info.m_method->full_name().c_str());
+            }
+        }
+    }
+}
+
+void MpzrpcProvider::addThreadPool(const std::string &name, int thread_num, int max_queued_calls)
+{
+    m_poolConfigs[name] = {thread_num, max_queued_calls};
+}
+
 void MpzrpcProvider::publishService(::google::protobuf::Service *service)
+{
+    publishService(service, MpzrpcServiceOptions());
+}
+
+void MpzrpcProvider::publishService(::google::protobuf::Service *service, const MpzrpcServiceOptions &options)
 {
     ServiceInfo service_info;
     const google::protobuf::ServiceDescriptor *psd = service->GetDescriptor();
     std::string service_name = psd->name();
     int method_count = psd->method_count();
 
+    // 按发布顺序为每个方法分配编号，编号即m_methodTable的下标加1
     for (int i = 0; i < method_count; ++i)
     {
         const google::protobuf::MethodDescriptor *pmd = psd->method(i);
-        service_info.m_methodmap.insert({pmd->name(), pmd});
+        bool run_inline = options.run_inline || options.inline_methods.count(pmd->name()) > 0;
+        auto pool_it = options.method_pools.find(pmd->name());
+        std::string pool_name = (pool_it != options.method_pools.end()) ? pool_it->second : options.pool;
+        m_methodTable.push_back({service, pmd, run_inline, pool_name, nullptr});
+        service_info.m_methodmap.insert({pmd->name(), (uint32_t)m_methodTable.size()});
     }
     service_info.m_service = service;
     m_servicemap.insert({service_name, service_info});
 }
 
+// 预留的哈希桶数，在途调用超过桶数时才扩容，稳定后不再分配
+static const size_t kInitialCallIndexSize = 64;
+
+static size_t CallIndexBucket(uint64_t request_id, size_t bucket_count)
+{
+    // 同一调用方的request_id是连续的，乘法散列后再取高位也能均匀分布
+    return (size_t)((request_id * 0x9E3779B97F4A7C15ULL) >> 32) & (bucket_count - 1);
+}
+
+RpcConnectionContext::RpcConnectionContext() : call_index(kInitialCallIndexSize, nullptr) {}
+
+void RpcConnectionContext::linkCall(RpcCallContext *call)
+{
+    // 在途调用较多时扩容一倍，所有调用重新挂到新的桶上
+    if (active_count >= call_index.size()) {
+        std::vector<RpcCallContext *> index(call_index.size() * 2, nullptr);
+        for (RpcCallContext *it = active_head; it != nullptr; it = it->active_next) {
+            size_t bucket = CallIndexBucket(it->reply.request_id, index.size());
+            it->index_next = index[bucket];
+            index[bucket] = it;
+        }
+        call_index.swap(index);
+    }
+
+    size_t bucket = CallIndexBucket(call->reply.request_id, call_index.size());
+    call->index_next = call_index[bucket];
+    call_index[bucket] = call;
+
+    call->active_prev = nullptr;
+    call->active_next = active_head;
+    if (active_head != nullptr) {
+        active_head->active_prev = call;
+    }
+    active_head = call;
+    call->active = true;
+    ++active_count;
+}
+
+void RpcConnectionContext::unlinkCall(RpcCallContext *call)
+{
+    if (!call->active) {
+        return;
+    }
+
+    RpcCallContext **slot = &call_index[CallIndexBucket(call->reply.request_id, call_index.size())];
+    while (*slot != call) {
+        slot = &(*slot)->index_next;
+    }
+    *slot = call->index_next;
+
+    if (call->active_prev != nullptr) {
+        call->active_prev->active_next = call->active_next;
+    } else {
+        active_head = call->active_next;
+    }
+    if (call->active_next != nullptr) {
+        call->active_next->active_prev = call->active_prev;
+    }
+    call->active = false;
+    --active_count;
+}
+
+RpcCallContext *RpcConnectionContext::findCall(uint64_t request_id) const
+{
+    RpcCallContext *call = call_index[CallIndexBucket(request_id, call_index.size())];
+    while (call != nullptr && call->reply.request_id != request_id) {
+        call = call->index_next;
+    }
+    return call;
+}
+
 void MpzrpcProvider::onConnectionCallback(const muduo::net::TcpConnectionPtr &conn)
 {
-    if (!conn->connected())
+    if (conn->connected())
+    {
+        spRpcConnectionContext context = std::make_shared<RpcConnectionContext>();
+        context->tenant = conn->peerAddress().toIp();
+        conn->setContext(context);
+    }
+    else
     {
-        // 客户端连接断开
-        // LOG_INFO("Client connection %s closed.", conn->name().c_str());
+        // 客户端连接断开，还没结束的调用都标记为取消，业务方法可以据此提前放弃
+        const spRpcConnectionContext *context = boost::any_cast<spRpcConnectionContext>(&conn->getContext());
+        if (context == nullptr) {
+            return;
+        }
+        std::vector<google::protobuf::Closure *> callbacks;
+        std::vector<RpcCallContext *> dropped;
+        {
+            std::lock_guard<std::mutex> lock((*context)->calls_mutex);
+            while ((*context)->active_head != nullptr) {
+                RpcCallContext *call = (*context)->active_head;
+                google::protobuf::Closure *callback = call->controller.SetCanceled();
+                if (callback != nullptr) {
+                    callbacks.push_back(callback);
+                }
+                (*context)->unlinkCall(call);
+                if (DropQueuedCall(call)) {
+                    dropped.push_back(call);
+                }
+            }
+        }
+        // 回调可能直接结束调用，不能在持有calls_mutex时执行
+        for (google::protobuf::Closure *callback : callbacks) {
+            callback->Run();
+        }
+        for (RpcCallContext *call : dropped) {
+            FinishCall(call);
+        }
     }
 }
 
@@ -95,89 +353,510 @@ void MpzrpcProvider::onMessageCallback(const muduo::net::TcpConnectionPtr &conn,
                                      muduo::net::Buffer *buffer,
                                      muduo::Timestamp receiveTime)
 {
+    // 请求的截止时间从服务端收到请求时算起，不依赖两端时钟同步
+    MpzrpcServerController::Clock::time_point receive_time = MpzrpcServerController::Clock::now();
+    const spRpcConnectionContext *context = boost::any_cast<spRpcConnectionContext>(&conn->getContext());
+    RpcConnectionContext *connection = (context != nullptr) ? context->get() : nullptr;
+
     // 处理粘包、半包问题的while循环
     while (buffer->readableBytes() >= 4)
     {
-        uint32_t header_size = buffer->peekInt32();
-        if (buffer->readableBytes() < 4 + header_size) {
-            break;
+        // 响应使用与请求相同的帧格式
+        RpcReplyInfo reply{conn, 0, 0, false};
+        uint32_t method_id = 0;
+        uint32_t timeout_ms = 0;
+        rpcheader::Priority priority = rpcheader::PRIORITY_NORMAL;
+        // 请求参数直接指向输入缓冲区，不再拷贝到std::string
+        // retrieve只移动读指针，本次回调返回前缓冲区不会写入新数据，指针始终有效
+        const char *args_data = nullptr;
+        uint32_t args_size = 0;
+
+        if ((uint32_t)buffer->peekInt32() == kMpzrpcFixedMagic)
+        {
+            // 固定格式帧头: 一次长度检查即可确定整帧是否到齐
+            if (buffer->readableBytes() < kMpzrpcFixedHeaderSize) {
+                break;
+            }
+            MpzrpcFixedHeader header;
+            if (!MpzrpcDecodeFixedHeader(buffer->peek(), &header)) {
+                LOG_ERROR("fixed header version error!");
+                conn->shutdown();
+                break;
+            }
+            if (header.body_size > m_maxRequestSize) {
+                LOG_ERROR("invalid body size: %u", header.body_size);
+                conn->shutdown();
+                break;
+            }
+            if (buffer->readableBytes() < kMpzrpcFixedHeaderSize + header.body_size) {
+                break;
+            }
+
+            args_data = buffer->peek() + kMpzrpcFixedHeaderSize;
+            args_size = header.body_size;
+            buffer->retrieve(kMpzrpcFixedHeaderSize + args_size);
+            if (header.flags & kMpzrpcFlagCancel) {
+                CancelCall(connection, header.request_id);
+                continue;
+            }
+            reply.request_id = header.request_id;
+            reply.fixed_format = true;
+            method_id = header.method_id;
+            timeout_ms = header.timeout_ms;
+            priority = (rpcheader::Priority)header.status;
         }
+        else
+        {
+            uint32_t header_size = buffer->peekInt32();
+            if (header_size > kMaxHeaderSize) {
+                LOG_ERROR("invalid header size: %u", header_size);
+                conn->shutdown();
+                break;
+            }
+            if (buffer->readableBytes() < 4 + header_size) {
+                break;
+            }
+
+            rpcheader::rpcheader header;
+            if (!header.ParseFromArray(buffer->peek() + 4, header_size)) {
+                LOG_ERROR("header parse error!");
+                conn->shutdown();
+                break;
+            }
+            
+            // 过大的args_size会让总长度回绕，解析时长度变为负数，直接断开连接
+            args_size = header.args_size();
+            if (args_size > m_maxRequestSize) {
+                LOG_ERROR("invalid args size: %u", args_size);
+                conn->shutdown();
+                break;
+            }
+            size_t total_size = 4 + (size_t)header_size + args_size;
+            if (buffer->readableBytes() < total_size) {
+                break;
+            }
 
-        rpcheader::rpcheader header;
-        if (!header.ParseFromArray(buffer->peek() + 4, header_size)) {
-            LOG_ERROR("header parse error!");
-            conn->shutdown();
-            break;
+            args_data = buffer->peek() + 4 + header_size;
+            buffer->retrieve(total_size);
+            if (header.cancel()) {
+                CancelCall(connection, header.request_id());
+                continue;
+            }
+            reply.request_id = header.request_id();
+            method_id = header.method_id();
+            timeout_ms = header.timeout_ms();
+            priority = header.priority();
+            if (!header.tenant().empty() && connection != nullptr) {
+                connection->tenant = header.tenant();
+            }
+
+            // 没有method_id时按名字查找，并在响应中把编号告知调用方
+            // 找不到时回复错误帧，整帧已被取走，可以继续处理后续请求
+            if (method_id == 0)
+            {
+                const std::string &service_name = header.service_name();
+                const std::string &method_name = header.method_name();
+
+                auto service_it = m_servicemap.find(service_name);
+                if (service_it == m_servicemap.end()) {
+                    LOG_ERROR("service:[%s] is not exist!", service_name.c_str());
+                    SendRpcFrame(reply, rpcheader::SERVICE_NOT_FOUND, "service " + service_name + " is not exist", nullptr);
+                    continue;
+                }
+
+                auto method_it = service_it->second.m_methodmap.find(method_name);
+                if (method_it == service_it->second.m_methodmap.end()) {
+                    LOG_ERROR("service:[%s] method:[%s] is not exist!", service_name.c_str(), method_name.c_str());
+                    SendRpcFrame(reply, rpcheader::METHOD_NOT_FOUND, "method " + service_name + "." + method_name + " is not exist", nullptr);
+                    continue;
+                }
+                method_id = method_it->second;
+                reply.method_id = method_id;
+            }
         }
-        
-        uint32_t args_size = header.args_size();
-        uint32_t total_size = 4 + header_size + args_size;
-        if (buffer->readableBytes() < total_size) {
-            break;
+
+        if (method_id == 0 || method_id > m_methodTable.size())
+        {
+            LOG_ERROR("method id:[%u] is not exist!", method_id);
+            SendRpcFrame(reply, rpcheader::METHOD_NOT_FOUND, "method id " + std::to_string(method_id) + " is not exist", nullptr);
+            continue;
         }
 
-        buffer->retrieve(4 + header_size);
-        std::string args_str = buffer->retrieveAsString(args_size);
+        // 按编号直接索引到服务和方法
+        google::protobuf::Service* service = m_methodTable[method_id - 1].m_service;
+        const google::protobuf::MethodDescriptor* method = m_methodTable[method_id - 1].m_method;
+        bool run_inline = m_shardMode || m_methodTable[method_id - 1].m_inline;
+        BusinessPool *pool = m_methodTable[method_id - 1].m_pool;
+
+        // 请求、响应和调用上下文都分配在本次调用的Arena上，响应发出后一起释放
+        MpzrpcPooledArena *arena = m_arenaPool.acquire();
+        google::protobuf::Message *request = service->GetRequestPrototype(method).New(&arena->arena);
+        if (!request->ParseFromArray(args_data, args_size)) {
+            LOG_ERROR("request parse error! method:[%s]", method->full_name().c_str());
+            m_arenaPool.release(arena);
+            SendRpcFrame(reply, rpcheader::REQUEST_PARSE_ERROR, "request parse error", nullptr);
+            continue;
+        }
+        google::protobuf::Message *response = service->GetResponsePrototype(method).New(&arena->arena);
         
-        // 查找服务和方法
-        std::string service_name = header.service_name();
-        std::string method_name = header.method_name();
+        // 响应需要带回request_id，客户端据此在多路复用的连接上找到对应的调用
+        // 调用上下文同时充当done和线程池任务，整个分发过程不再有额外的堆分配
+        RpcCallContext *call = google::protobuf::Arena::Create<RpcCallContext>(&arena->arena, this, reply);
+        call->service = service;
+        call->method = method;
+        call->request = request;
+        call->response = response;
+        call->arena = arena;
+        call->connection = connection;
+        call->controller.SetPeer(conn->peerAddress());
+        call->controller.MarkReceived(receive_time);
+        call->controller.MarkEnqueued();
+        call->priority_class = MpzrpcCallScheduler::ClassOf(priority);
+        if (timeout_ms > 0) {
+            call->controller.SetDeadline(receive_time + std::chrono::milliseconds(timeout_ms));
+        }
+        if (connection != nullptr) {
+            std::lock_guard<std::mutex> lock(connection->calls_mutex);
+            connection->linkCall(call);
+        }
 
-        auto service_it = m_servicemap.find(service_name);
-        if (service_it == m_servicemap.end()) {
-            LOG_ERROR("service:[%s] is not exist!", service_name.c_str());
-            break;
+        // 廉价方法直接在当前IO线程执行，响应也由本线程写出
+        if (run_inline) {
+            ExecuteCall(call);
+            continue;
         }
 
-        auto method_it = service_it->second.m_methodmap.find(method_name);
-        if (method_it == service_it->second.m_methodmap.end()) {
-            LOG_ERROR("service:[%s] method:[%s] is not exist!", service_name.c_str(), method_name.c_str());
-            break;
+        // 将业务调用提交到方法所属的线程池处理
+        DispatchCall(pool, call, (connection != nullptr) ? connection->tenant : conn->peerAddress().toIp());
+    }
+}
+
+void MpzrpcProvider::DispatchCall(BusinessPool *pool, RpcCallContext *call, const std::string &tenant)
+{
+    // 在途请求超过自适应上限时和队列已满一样处理，由调度队列挤掉优先级最低的请求，
+    // 而不是直接拒绝刚到的请求，高优先级的请求仍然优先得到名额
+    // 入队后请求随时可能被业务线程取出，名额的归属须在入队前确定
+    bool over_limit = false;
+    if (pool->limiter != nullptr) {
+        over_limit = !pool->limiter->tryAcquire();
+        call->limited = true;
+    }
+    call->pool = pool;
+
+    // 线程池只服务过一个调用方、一个等级时不经过调度队列，IO线程和业务线程不争抢scheduler的锁
+    // 第二个调用方或等级出现前已经投递的请求照常按投递顺序执行
+    MpzrpcCallScheduler::BypassResult bypass = pool->scheduler.bypass(call->priority_class, tenant, over_limit);
+    if (bypass == MpzrpcCallScheduler::kBypassRun) {
+        pool->executor->post([this, pool, call]() {
+            pool->scheduler.bypassStarted();
+            mpzrpcCurrentResumeExecutor() = &pool->resume_executor;
+            ExecuteCall(call);
+        });
+        return;
+    }
+
+    // 排队的请求已经太多，立即回复过载让调用方换节点，而不是排队直到调用方超时
+    // 被拒绝的总是排队请求中优先级最低的那个，可能是刚到的请求，也可能是被它挤掉的请求
+    RpcCallContext *shed = nullptr;
+    if (bypass == MpzrpcCallScheduler::kBypassReject || !pool->scheduler.push(call, tenant, over_limit, &shed)) {
+        shed = call;
+    }
+    // 超出上限时刚到的请求没有占到名额: 它自己被拒绝时不归还，挤掉了别的请求时接过被挤掉请求的名额
+    if (over_limit && shed != nullptr) {
+        shed->limited = false;
+    }
+    if (shed != nullptr) {
+        // 过载时逐个写日志本身就会在IO线程上格式化字符串、撑大日志队列，只计数
+        m_shedCalls.fetch_add(1, std::memory_order_relaxed);
+        if (!shed->controller.IsCanceled()) {
+            SendRpcFrame(shed->reply, rpcheader::OVERLOADED, "server overloaded", nullptr);
         }
+        FinishCall(shed);
+    }
+    if (shed == call) {
+        return;
+    }
 
-        // 定义正确的指针变量
-        google::protobuf::Service* service = service_it->second.m_service;
-        const google::protobuf::MethodDescriptor* method = method_it->second;
+    // 任务不绑定具体的请求，执行时才从调度队列中取出当前优先级最高、轮到的调用方的请求
+    // 请求被挤掉后它对应的任务取到的可能是空队列，直接返回即可
+    pool->executor->post([this, pool]() {
+        RpcCallContext *next = pool->scheduler.pop();
+        if (next == nullptr) {
+            return;
+        }
+        // 协程处理函数co_await后回到同一个线程池继续执行
+        mpzrpcCurrentResumeExecutor() = &pool->resume_executor;
+        ExecuteCall(next);
+    });
+}
 
-        google::protobuf::Message *request = service->GetRequestPrototype(method).New();
-        if (!request->ParseFromString(args_str)) {
-            LOG_ERROR("request parse error! content:%s", args_str.c_str());
-            delete request;
-            break;
+bool MpzrpcProvider::getSchedulerStats(const std::string &pool_name, MpzrpcCallScheduler::ClassStats *stats) const
+{
+    auto it = m_pools.find(pool_name);
+    if (it == m_pools.end()) {
+        return false;
+    }
+    for (int cls = 0; cls < MpzrpcCallScheduler::kClassCount; ++cls) {
+        stats[cls] = it->second->scheduler.stats(cls);
+    }
+    return true;
+}
+
+void MpzrpcProvider::ExpireIdleTenants()
+{
+    for (auto &item : m_pools) {
+        item.second->scheduler.expireIdleTenants();
+    }
+}
+
+void MpzrpcProvider::LogDroppedCalls()
+{
+    uint64_t shed = m_shedCalls.exchange(0, std::memory_order_relaxed);
+    uint64_t queue_timeout = m_queueTimeoutCalls.exchange(0, std::memory_order_relaxed);
+    uint64_t deadline = m_deadlineDroppedCalls.exchange(0, std::memory_order_relaxed);
+    if (shed + queue_timeout + deadline == 0) {
+        return;
+    }
+    LOG_ERROR("dropped calls in last %ds: overloaded:%lu queue timeout:%lu deadline exceeded:%lu",
+              kDropLogSeconds, (unsigned long)shed, (unsigned long)queue_timeout, (unsigned long)deadline);
+}
+
+void MpzrpcProvider::LogSchedulerStats() const
+{
+    static const char *kClassNames[MpzrpcCallScheduler::kClassCount] = {"high", "normal", "low", "batch"};
+    for (auto &item : m_pools)
+    {
+        for (int cls = 0; cls < MpzrpcCallScheduler::kClassCount; ++cls)
+        {
+            MpzrpcCallScheduler::ClassStats stats = item.second->scheduler.stats(cls);
+            LOG_INFO("thread pool:[%s] priority:[%s] queued:%zu tenants:%zu dispatched:%lu shed:%lu",
+                     item.first.c_str(), kClassNames[cls], stats.queued, stats.tenants,
+                     (unsigned long)stats.dispatched, (unsigned long)stats.shed);
+        }
+        if (item.second->limiter != nullptr) {
+            LOG_INFO("thread pool:[%s] concurrency limit:%d inflight:%d",
+                     item.first.c_str(), item.second->limiter->limit(), item.second->limiter->inflight());
         }
-        google::protobuf::Message *response = service->GetResponsePrototype(method).New();
-        
-        google::protobuf::Closure *done = google::protobuf::NewCallback<MpzrpcProvider,
-                                                                        const muduo::net::TcpConnectionPtr &,
-                                                                        google::protobuf::Message *>(this,
-                                                                                                        &MpzrpcProvider::SendRpcResponse,
-                                                                                                        conn,
-                                                                                                        response);
-
-        // 将业务调用提交到线程池处理
-        m_threadPool->enqueue([=]() {
-            // 在业务线程中执行RPC方法
-            service->CallMethod(method, nullptr, request, response, done);
-        });
     }
 }
 
-void MpzrpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response)
+void MpzrpcProvider::CancelCall(RpcConnectionContext *connection, uint64_t request_id)
 {
-    std::string response_str;
-    if (response->SerializeToString(&response_str)) {
-        conn->send(response_str);
-    } else {
-        LOG_ERROR("serialize response_str error!");
-    }
-    // 注意：response对象是由NewCallback创建的Closure在执行后自动管理的，
-    // 通常不需要手动delete response。但request需要注意。
-    // 在我们的设计中，request的生命周期由业务方法CallMethod的实现者负责。
-    // 如果业务方法(如UserService::Login)没有delete request，它就会内存泄漏。
-    // 一个更安全的设计是在上面的lambda中CallMethod之后delete request。
-    // google::protobuf::Service::CallMethod执行完毕后，request和response参数的内存如何管理，需要根据具体业务实现来定。
-    // 在protobuf的原始设计中，调用者需要负责释放request和response。
-    // 所以我们应该在done回调中，即此函数中，来释放response。
-    // 为了简单起见，我们暂时假设业务代码会处理request，此处的done会处理response。
-    // 一个更完整的框架需要对此有更严格的内存管理约定。
-}
\ No newline at end of file
+    if (connection == nullptr) {
+        return;
+    }
+
+    // 排队中的调用直接从调度队列移除并结束，运行中的调用由业务方法通过IsCanceled自行决定是否放弃
+    google::protobuf::Closure *callback = nullptr;
+    bool dropped = false;
+    RpcCallContext *call = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(connection->calls_mutex);
+        call = connection->findCall(request_id);
+        if (call == nullptr) {
+            // 调用已经结束，取消帧与响应擦肩而过
+            return;
+        }
+        callback = call->controller.SetCanceled();
+        connection->unlinkCall(call);
+        dropped = DropQueuedCall(call);
+    }
+    if (callback != nullptr) {
+        callback->Run();
+    }
+    if (dropped) {
+        FinishCall(call);
+    }
+}
+
+bool MpzrpcProvider::DropQueuedCall(RpcCallContext *call)
+{
+    // 须持有calls_mutex调用，此时调用不会被结束，call一定有效
+    // 已经被业务线程取出的调用由ExecuteCall发现已取消后结束
+    return call->pool != nullptr && call->pool->scheduler.remove(call);
+}
+
+void MpzrpcProvider::ExecuteCall(RpcCallContext *call)
+{
+    call->controller.MarkStarted();
+
+    // 调用方已经断开或取消，不需要执行也不需要回复
+    if (call->controller.IsCanceled())
+    {
+        FinishCall(call);
+        return;
+    }
+
+    // 排队太久的请求调用方多半已经超时，不再执行，回复过载
+    if (m_maxQueueWaitMs > 0 &&
+        call->controller.StartTime() - call->controller.EnqueueTime() > std::chrono::milliseconds(m_maxQueueWaitMs))
+    {
+        m_queueTimeoutCalls.fetch_add(1, std::memory_order_relaxed);
+        SendRpcFrame(call->reply, rpcheader::OVERLOADED, "server overloaded, request waited too long in queue", nullptr);
+        FinishCall(call);
+        return;
+    }
+
+    // 调用方已经放弃等待，执行了也没人要结果
+    if (call->controller.IsExpired())
+    {
+        m_deadlineDroppedCalls.fetch_add(1, std::memory_order_relaxed);
+        SendRpcFrame(call->reply, rpcheader::DEADLINE_EXCEEDED, "deadline exceeded before execution", nullptr);
+        FinishCall(call);
+        return;
+    }
+
+    // 执行RPC方法，协程处理函数挂起时当前线程即被释放
+    call->service->CallMethod(call->method, &call->controller, call->request, call->response, call);
+}
+
+void RpcCallContext::Run()
+{
+    provider->SendRpcResponse(this);
+}
+
+void MpzrpcProvider::SendRpcResponse(RpcCallContext *call)
+{
+    // 已取消的调用没人等待结果，不再回复
+    // 业务方法调用了SetFailed时回复错误帧，错误原因原样带回给调用方
+    if (!call->controller.IsCanceled()) {
+        if (call->controller.Failed()) {
+            SendRpcFrame(call->reply, rpcheader::APPLICATION_ERROR, call->controller.ErrorText(), nullptr);
+        } else {
+            SendRpcFrame(call->reply, rpcheader::OK, "", call->response);
+        }
+    }
+    FinishCall(call);
+}
+
+void MpzrpcProvider::FinishCall(RpcCallContext *call)
+{
+    if (call->connection != nullptr) {
+        std::lock_guard<std::mutex> lock(call->connection->calls_mutex);
+        call->connection->unlinkCall(call);
+    }
+    google::protobuf::Closure *callback = call->controller.TakeCancelCallback();
+
+    // 按本次调用从开始执行到结束的时间修正调用方的额度
+    // 协程处理函数挂起等待的时间也计算在内，对同一调用方的请求一视同仁
+    MpzrpcServerController::Clock::time_point finish_time = MpzrpcServerController::Clock::now();
+    bool dequeued = call->tenant != nullptr;
+    if (dequeued) {
+        int64_t cost_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            finish_time - call->controller.StartTime()).count();
+        call->pool->scheduler.finish(call, cost_us);
+    }
+
+    // 并发限制按从接收到结束的耗时调整，排队时间变长正是需要收紧的信号
+    // 被挤掉或被取消的调用没有真正执行，只归还名额
+    if (call->limited) {
+        int64_t rtt_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            finish_time - call->controller.ReceiveTime()).count();
+        call->pool->limiter->release(rtt_us, dequeued && !call->controller.IsCanceled());
+    }
+
+    // request、response和call本身都在Arena上，业务方法不需要也不能delete它们
+    m_arenaPool.release(call->arena);
+
+    // 没有被取消的调用在结束后执行NotifyOnCancel回调
+    if (callback != nullptr) {
+        callback->Run();
+    }
+}
+
+void MpzrpcProvider::SendRpcFrame(const RpcReplyInfo &reply,
+                                  rpcheader::StatusCode status,
+                                  const std::string &error_text,
+                                  const google::protobuf::Message *response)
+{
+    // 响应帧直接在muduo::net::Buffer中组装，body用SerializeToArray写入可写区域，
+    // 不再经过临时的std::string
+    size_t response_size = (response != nullptr) ? response->ByteSizeLong() : 0;
+    muduo::net::Buffer frame;
+
+    if (reply.fixed_format)
+    {
+        // 固定格式响应帧: [MpzrpcFixedHeader][response 或 error_text]
+        size_t body_size = (status == rpcheader::OK) ? response_size : error_text.size();
+        MpzrpcFixedHeader header = {kMpzrpcFixedMagic, kMpzrpcFixedVersion, kMpzrpcFlagResponse,
+                                    (uint16_t)status, 0, reply.request_id, (uint32_t)body_size, 0};
+        frame.ensureWritableBytes(kMpzrpcFixedHeaderSize + body_size);
+        MpzrpcEncodeFixedHeader(header, frame.beginWrite());
+        frame.hasWritten(kMpzrpcFixedHeaderSize);
+        if (status != rpcheader::OK) {
+            frame.append(error_text);
+        }
+    }
+    else
+    {
+        // 响应帧: [4字节header_size][rpcresponseheader][response]
+        rpcheader::rpcresponseheader header;
+        header.set_response_size(response_size);
+        header.set_status(status);
+        header.set_request_id(reply.request_id);
+        header.set_method_id(reply.method_id);
+        if (!error_text.empty()) {
+            header.set_error_text(error_text);
+        }
+
+        size_t header_size = header.ByteSizeLong();
+        frame.ensureWritableBytes(header_size + response_size);
+        if (!header.SerializeToArray(frame.beginWrite(), header_size)) {
+            LOG_ERROR("serialize response header error!");
+            return;
+        }
+        frame.hasWritten(header_size);
+        // 长度前缀写入Buffer预留的prepend空间
+        frame.prependInt32(header_size);
+    }
+
+    if (response != nullptr && status == rpcheader::OK)
+    {
+        if (!response->SerializeToArray(frame.beginWrite(), response_size)) {
+            LOG_ERROR("serialize response_str error!");
+            SendRpcFrame(reply, rpcheader::INTERNAL_ERROR, "serialize response error", nullptr);
+            return;
+        }
+        frame.hasWritten(response_size);
+    }
+
+    QueueRpcFrame(reply.conn, &frame);
+}
+
+void MpzrpcProvider::QueueRpcFrame(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *frame)
+{
+    const spRpcConnectionContext *context = boost::any_cast<spRpcConnectionContext>(&conn->getContext());
+    if (context == nullptr) {
+        conn->send(frame);
+        return;
+    }
+
+    // 同一连接上完成的响应先合并到待发送缓冲区，只有第一个响应负责唤醒IO线程
+    // 缓冲区为空时直接交换，大响应也不会多拷贝一次
+    spRpcConnectionContext ctx = *context;
+    bool need_flush = false;
+    {
+        std::lock_guard<std::mutex> lock(ctx->send_mutex);
+        if (ctx->pending_frames.readableBytes() == 0) {
+            ctx->pending_frames.swap(*frame);
+        } else {
+            ctx->pending_frames.append(frame->peek(), frame->readableBytes());
+        }
+        need_flush = !ctx->flush_scheduled;
+        ctx->flush_scheduled = true;
+    }
+    if (!need_flush) {
+        return;
+    }
+
+    // queueInLoop保证在本轮事件处理之后执行，期间到达的响应用一次write写出
+    conn->getLoop()->queueInLoop([conn, ctx]() {
+        muduo::net::Buffer frames;
+        {
+            std::lock_guard<std::mutex> lock(ctx->send_mutex);
+            frames.swap(ctx->pending_frames);
+            ctx->flush_scheduled = false;
+        }
+        conn->send(&frames);
+    });
+}
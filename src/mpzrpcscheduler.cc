@@ -0,0 +1,373 @@
+#include "mpzrpcscheduler.h"
+#include "mpzrpcprovider.h"
+
+// 调用方在一个等级中排队的请求，链表节点指针在调用上下文中，入队出队都不分配内存
+struct MpzrpcCallQueue
+{
+    RpcCallContext *head = nullptr;
+    RpcCallContext *tail = nullptr;
+    size_t size = 0;
+
+    bool empty() const { return head == nullptr; }
+
+    void pushBack(RpcCallContext *call)
+    {
+        call->sched_prev = tail;
+        call->sched_next = nullptr;
+        if (tail != nullptr) {
+            tail->sched_next = call;
+        } else {
+            head = call;
+        }
+        tail = call;
+        ++size;
+    }
+
+    void erase(RpcCallContext *call)
+    {
+        if (call->sched_prev != nullptr) {
+            call->sched_prev->sched_next = call->sched_next;
+        } else {
+            head = call->sched_next;
+        }
+        if (call->sched_next != nullptr) {
+            call->sched_next->sched_prev = call->sched_prev;
+        } else {
+            tail = call->sched_prev;
+        }
+        call->sched_prev = nullptr;
+        call->sched_next = nullptr;
+        --size;
+    }
+};
+
+struct MpzrpcCallScheduler::Tenant
+{
+    std::string name;
+    int64_t deficit_us = 0;         // 剩余额度，可以为负，表示预扣少了需要在之后的轮次补上
+    int64_t cost_estimate_us = 0;   // 请求的平均耗时，出队时按它预扣额度，空闲期间也保留
+    int running = 0;                // 已出队还没结束的请求数
+    bool touched = false;           // 上次expireIdleTenants以来是否有新请求
+    MpzrpcCallQueue calls[kClassCount];
+
+    // 在每个等级的轮转环中的前后节点
+    Tenant *ring_prev[kClassCount] = {};
+    Tenant *ring_next[kClassCount] = {};
+
+    bool hasQueued() const
+    {
+        for (int cls = 0; cls < kClassCount; ++cls) {
+            if (!calls[cls].empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool idle() const { return running == 0 && !hasQueued(); }
+};
+
+MpzrpcCallScheduler::MpzrpcCallScheduler(int max_queued, int quantum_us)
+    : m_maxQueued(max_queued > 0 ? max_queued : 0),
+      m_quantumUs(quantum_us > 0 ? quantum_us : 1)
+{
+}
+
+MpzrpcCallScheduler::~MpzrpcCallScheduler()
+{
+    for (auto &item : m_tenants) {
+        delete item.second;
+    }
+}
+
+int MpzrpcCallScheduler::ClassOf(rpcheader::Priority priority)
+{
+    switch (priority)
+    {
+    case rpcheader::PRIORITY_HIGH:
+        return 0;
+    case rpcheader::PRIORITY_LOW:
+        return 2;
+    case rpcheader::PRIORITY_BATCH:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+MpzrpcCallScheduler::BypassResult MpzrpcCallScheduler::bypass(int cls, const std::string &tenant, bool over_limit)
+{
+    int mode = m_mode.load(std::memory_order_acquire);
+    if (mode == kModeUnknown) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        mode = m_mode.load(std::memory_order_relaxed);
+        if (mode == kModeUnknown) {
+            m_singleClass = cls;
+            m_singleTenant = tenant;
+            mode = kModeSingle;
+            m_mode.store(mode, std::memory_order_release);
+        }
+    }
+    if (mode != kModeSingle) {
+        return kBypassQueue;
+    }
+    if (cls != m_singleClass || tenant != m_singleTenant) {
+        // 已经直接投递的请求照常执行，之后的请求都经过队列
+        m_mode.store(kModeShared, std::memory_order_relaxed);
+        return kBypassQueue;
+    }
+
+    // 同一调用方在同一等级中只能挤掉自己，与push的规则一致，直接拒绝刚到的请求
+    if (over_limit || (m_maxQueued > 0 && m_bypassQueued.load(std::memory_order_relaxed) >= m_maxQueued)) {
+        m_bypassShed.fetch_add(1, std::memory_order_relaxed);
+        return kBypassReject;
+    }
+    m_bypassQueued.fetch_add(1, std::memory_order_relaxed);
+    return kBypassRun;
+}
+
+void MpzrpcCallScheduler::bypassStarted()
+{
+    m_bypassQueued.fetch_sub(1, std::memory_order_relaxed);
+    m_bypassDispatched.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MpzrpcCallScheduler::push(RpcCallContext *call, const std::string &tenant, bool over_limit, RpcCallContext **shed)
+{
+    *shed = nullptr;
+    int cls = call->priority_class;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 调用方的状态创建后一直保留，之后的请求只需查找，不再分配内存
+    Tenant *&slot = m_tenants[tenant];
+    if (slot == nullptr) {
+        slot = new Tenant();
+        slot->name = tenant;
+        // 还不知道这个调用方的请求耗时，先按一轮额度预扣
+        slot->cost_estimate_us = m_quantumUs;
+    }
+    Tenant *owner = slot;
+    owner->touched = true;
+
+    if (over_limit || (m_maxQueued > 0 && m_size >= m_maxQueued))
+    {
+        int victim_cls = cls;
+        Tenant *victim = pickVictim(owner, cls, owner->calls[cls].size + 1, &victim_cls);
+        if (victim == nullptr) {
+            ++m_stats[cls].shed;
+            return false;
+        }
+        *shed = removeBack(victim, victim_cls);
+        ++m_stats[victim_cls].shed;
+    }
+
+    if (owner->calls[cls].empty()) {
+        ringPushBack(cls, owner);
+    }
+    owner->calls[cls].pushBack(call);
+    call->tenant = owner;
+    call->queued = true;
+    ++m_size;
+    return true;
+}
+
+RpcCallContext *MpzrpcCallScheduler::pop()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (int cls = 0; cls < kClassCount; ++cls)
+    {
+        if (m_ring[cls] == nullptr) {
+            continue;
+        }
+
+        // 额度用完的调用方补充一轮额度后排到队尾
+        // 所有调用方都在还欠额时，直接补足到队头的调用方有额度为止，避免空转很多轮
+        size_t rotated = 0;
+        while (m_ring[cls]->deficit_us <= 0)
+        {
+            if (rotated == m_ringSize[cls]) {
+                int64_t rounds = -m_ring[cls]->deficit_us / m_quantumUs + 1;
+                Tenant *tenant = m_ring[cls];
+                for (size_t i = 0; i < m_ringSize[cls]; ++i) {
+                    tenant->deficit_us += rounds * m_quantumUs;
+                    tenant = tenant->ring_next[cls];
+                }
+                break;
+            }
+            m_ring[cls]->deficit_us += m_quantumUs;
+            ringRotate(cls);
+            ++rotated;
+        }
+
+        Tenant *tenant = m_ring[cls];
+        RpcCallContext *call = tenant->calls[cls].head;
+        tenant->calls[cls].erase(call);
+        call->queued = false;
+        tenant->deficit_us -= tenant->cost_estimate_us;
+        ++tenant->running;
+        call->charged_us = tenant->cost_estimate_us;
+        if (tenant->calls[cls].empty()) {
+            ringErase(cls, tenant);
+            // 与标准DRR一样，没有请求排队时不积攒额度，欠下的额度仍然保留
+            if (!tenant->hasQueued() && tenant->deficit_us > 0) {
+                tenant->deficit_us = 0;
+            }
+        }
+        ++m_stats[cls].dispatched;
+        --m_size;
+        return call;
+    }
+    return nullptr;
+}
+
+bool MpzrpcCallScheduler::remove(RpcCallContext *call)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!call->queued) {
+        return false;
+    }
+    Tenant *tenant = call->tenant;
+    int cls = call->priority_class;
+    tenant->calls[cls].erase(call);
+    if (tenant->calls[cls].empty()) {
+        ringErase(cls, tenant);
+    }
+    call->queued = false;
+    call->tenant = nullptr;
+    --m_size;
+    return true;
+}
+
+void MpzrpcCallScheduler::finish(RpcCallContext *call, int64_t cost_us)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Tenant *tenant = call->tenant;
+    tenant->deficit_us -= cost_us - call->charged_us;
+    tenant->cost_estimate_us += (cost_us - tenant->cost_estimate_us) / 8;
+    --tenant->running;
+    // 实际耗时比预扣的少时会退回额度，调用方已经没有请求排队的话，退回的额度也按pop中的规则清零
+    if (!tenant->hasQueued() && tenant->deficit_us > 0) {
+        tenant->deficit_us = 0;
+    }
+}
+
+MpzrpcCallScheduler::ClassStats MpzrpcCallScheduler::stats(int cls) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ClassStats result = m_stats[cls];
+    result.tenants = m_ringSize[cls];
+    if (cls == m_singleClass && m_mode.load(std::memory_order_relaxed) != kModeUnknown) {
+        result.queued += m_bypassQueued.load(std::memory_order_relaxed);
+        result.dispatched += m_bypassDispatched.load(std::memory_order_relaxed);
+        result.shed += m_bypassShed.load(std::memory_order_relaxed);
+    }
+    Tenant *tenant = m_ring[cls];
+    for (size_t i = 0; i < m_ringSize[cls]; ++i) {
+        result.queued += tenant->calls[cls].size;
+        tenant = tenant->ring_next[cls];
+    }
+    return result;
+}
+
+MpzrpcCallScheduler::Tenant *MpzrpcCallScheduler::pickVictim(Tenant *owner, int cls, size_t owner_queued, int *victim_cls) const
+{
+    // 先从最低等级开始找比自己低的排队请求，挤掉排队最多的调用方最后到达的那个
+    for (int lower = kClassCount - 1; lower > cls; --lower) {
+        Tenant *victim = longestTenant(lower);
+        if (victim != nullptr) {
+            *victim_cls = lower;
+            return victim;
+        }
+    }
+    // 同一等级中，只挤掉排队比自己多的其他调用方，泛滥的调用方只会挤掉自己的请求
+    Tenant *victim = longestTenant(cls);
+    if (victim == owner || (victim != nullptr && victim->calls[cls].size <= owner_queued)) {
+        return nullptr;
+    }
+    *victim_cls = cls;
+    return victim;
+}
+
+MpzrpcCallScheduler::Tenant *MpzrpcCallScheduler::longestTenant(int cls) const
+{
+    Tenant *longest = nullptr;
+    Tenant *tenant = m_ring[cls];
+    for (size_t i = 0; i < m_ringSize[cls]; ++i) {
+        if (longest == nullptr || tenant->calls[cls].size > longest->calls[cls].size) {
+            longest = tenant;
+        }
+        tenant = tenant->ring_next[cls];
+    }
+    return longest;
+}
+
+RpcCallContext *MpzrpcCallScheduler::removeBack(Tenant *tenant, int cls)
+{
+    RpcCallContext *call = tenant->calls[cls].tail;
+    tenant->calls[cls].erase(call);
+    if (tenant->calls[cls].empty()) {
+        ringErase(cls, tenant);
+    }
+    call->tenant = nullptr;
+    call->queued = false;
+    --m_size;
+    return call;
+}
+
+void MpzrpcCallScheduler::ringPushBack(int cls, Tenant *tenant)
+{
+    Tenant *head = m_ring[cls];
+    if (head == nullptr) {
+        tenant->ring_prev[cls] = tenant;
+        tenant->ring_next[cls] = tenant;
+        m_ring[cls] = tenant;
+    } else {
+        Tenant *tail = head->ring_prev[cls];
+        tenant->ring_prev[cls] = tail;
+        tenant->ring_next[cls] = head;
+        tail->ring_next[cls] = tenant;
+        head->ring_prev[cls] = tenant;
+    }
+    ++m_ringSize[cls];
+}
+
+void MpzrpcCallScheduler::ringErase(int cls, Tenant *tenant)
+{
+    if (tenant->ring_next[cls] == tenant) {
+        m_ring[cls] = nullptr;
+    } else {
+        tenant->ring_prev[cls]->ring_next[cls] = tenant->ring_next[cls];
+        tenant->ring_next[cls]->ring_prev[cls] = tenant->ring_prev[cls];
+        if (m_ring[cls] == tenant) {
+            m_ring[cls] = tenant->ring_next[cls];
+        }
+    }
+    tenant->ring_prev[cls] = nullptr;
+    tenant->ring_next[cls] = nullptr;
+    --m_ringSize[cls];
+}
+
+void MpzrpcCallScheduler::ringRotate(int cls)
+{
+    m_ring[cls] = m_ring[cls]->ring_next[cls];
+}
+
+size_t MpzrpcCallScheduler::expireIdleTenants()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t expired = 0;
+    for (auto it = m_tenants.begin(); it != m_tenants.end(); )
+    {
+        Tenant *tenant = it->second;
+        if (tenant->idle() && !tenant->touched) {
+            // 空闲很久的调用方欠下的额度一笔勾销，重新出现时和新的调用方一样从零开始
+            delete tenant;
+            it = m_tenants.erase(it);
+            ++expired;
+        } else {
+            tenant->touched = false;
+            ++it;
+        }
+    }
+    return expired;
+}
@@ -0,0 +1,103 @@
+#include "mpzrpcservercontroller.h"
+
+MpzrpcServerController::MpzrpcServerController()
+{
+    m_failed = false;
+    m_errText = "";
+    m_hasDeadline = false;
+    m_canceled = false;
+    m_cancelCallback = nullptr;
+}
+
+void MpzrpcServerController::Reset()
+{
+    m_failed = false;
+    m_errText = "";
+    m_hasDeadline = false;
+}
+
+bool MpzrpcServerController::Failed() const
+{
+    return m_failed;
+}
+
+std::string MpzrpcServerController::ErrorText() const
+{
+    return m_errText;
+}
+
+// 服务端不发起取消
+void MpzrpcServerController::StartCancel() {}
+
+void MpzrpcServerController::SetFailed(const std::string &reason)
+{
+    m_failed = true;
+    m_errText = reason;
+}
+
+bool MpzrpcServerController::IsCanceled() const
+{
+    return m_canceled;
+}
+
+void MpzrpcServerController::NotifyOnCancel(google::protobuf::Closure *callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if (!m_canceled) {
+            m_cancelCallback = callback;
+            return;
+        }
+    }
+    callback->Run();
+}
+
+google::protobuf::Closure *MpzrpcServerController::SetCanceled()
+{
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    if (m_canceled) {
+        return nullptr;
+    }
+    m_canceled = true;
+    google::protobuf::Closure *callback = m_cancelCallback;
+    m_cancelCallback = nullptr;
+    return callback;
+}
+
+google::protobuf::Closure *MpzrpcServerController::TakeCancelCallback()
+{
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    google::protobuf::Closure *callback = m_cancelCallback;
+    m_cancelCallback = nullptr;
+    return callback;
+}
+
+void MpzrpcServerController::SetDeadline(Clock::time_point deadline)
+{
+    m_hasDeadline = true;
+    m_deadline = deadline;
+}
+
+bool MpzrpcServerController::HasDeadline() const
+{
+    return m_hasDeadline;
+}
+
+MpzrpcServerController::Clock::time_point MpzrpcServerController::Deadline() const
+{
+    return m_deadline;
+}
+
+int64_t MpzrpcServerController::RemainingMs() const
+{
+    if (!m_hasDeadline) {
+        return -1;
+    }
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(m_deadline - Clock::now()).count();
+    return remaining > 0 ? remaining : 0;
+}
+
+bool MpzrpcServerController::IsExpired() const
+{
+    return m_hasDeadline && Clock::now() >= m_deadline;
+}
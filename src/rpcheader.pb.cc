@@ -22,10 +22,17 @@ namespace _pbi = _pb::internal;
 
 namespace rpcheader {
 PROTOBUF_CONSTEXPR rpcheader::rpcheader(
-    ::_pbi::ConstantInitialized)
-  : service_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , method_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , args_size_(0u){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tenant_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.args_size_)*/0u
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.cancel_)*/false
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct rpcheaderDefaultTypeInternal {
   PROTOBUF_CONSTEXPR rpcheaderDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -35,9 +42,26 @@ struct rpcheaderDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 rpcheaderDefaultTypeInternal _rpcheader_default_instance_;
+PROTOBUF_CONSTEXPR rpcresponseheader::rpcresponseheader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_size_)*/0u
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct rpcresponseheaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR rpcresponseheaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~rpcresponseheaderDefaultTypeInternal() {}
+  union {
+    rpcresponseheader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 rpcresponseheaderDefaultTypeInternal _rpcresponseheader_default_instance_;
 }  // namespace rpcheader
-static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[1];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpcheader_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_rpcheader_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpcheader_2eproto = nullptr;
 
 const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -47,28 +71,61 @@ const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABL
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, service_name_),
-  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, method_name_),
-  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, args_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.args_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.cancel_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcheader, _impl_.tenant_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _impl_.response_size_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::rpcheader::rpcresponseheader, _impl_.method_id_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::rpcheader::rpcheader)},
+  { 15, -1, -1, sizeof(::rpcheader::rpcresponseheader)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::rpcheader::_rpcheader_default_instance_._instance,
+  &::rpcheader::_rpcresponseheader_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_rpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\017rpcheader.proto\022\trpcheader\"I\n\trpcheade"
-  "r\022\024\n\014service_name\030\001 \001(\014\022\023\n\013method_name\030\002"
-  " \001(\014\022\021\n\targs_size\030\003 \001(\rb\006proto3"
+  "\n\017rpcheader.proto\022\trpcheader\"\313\001\n\trpchead"
+  "er\022\024\n\014service_name\030\001 \001(\014\022\023\n\013method_name\030"
+  "\002 \001(\014\022\021\n\targs_size\030\003 \001(\r\022\022\n\nrequest_id\030\004"
+  " \001(\004\022\021\n\tmethod_id\030\005 \001(\r\022\022\n\ntimeout_ms\030\006 "
+  "\001(\r\022\016\n\006cancel\030\007 \001(\010\022%\n\010priority\030\010 \001(\0162\023."
+  "rpcheader.Priority\022\016\n\006tenant\030\t \001(\014\"\214\001\n\021r"
+  "pcresponseheader\022\025\n\rresponse_size\030\001 \001(\r\022"
+  "%\n\006status\030\002 \001(\0162\025.rpcheader.StatusCode\022\022"
+  "\n\nerror_text\030\003 \001(\014\022\022\n\nrequest_id\030\004 \001(\004\022\021"
+  "\n\tmethod_id\030\005 \001(\r*X\n\010Priority\022\023\n\017PRIORIT"
+  "Y_NORMAL\020\000\022\021\n\rPRIORITY_HIGH\020\001\022\020\n\014PRIORIT"
+  "Y_LOW\020\002\022\022\n\016PRIORITY_BATCH\020\003*\254\001\n\nStatusCo"
+  "de\022\006\n\002OK\020\000\022\025\n\021SERVICE_NOT_FOUND\020\001\022\024\n\020MET"
+  "HOD_NOT_FOUND\020\002\022\027\n\023REQUEST_PARSE_ERROR\020\003"
+  "\022\022\n\016INTERNAL_ERROR\020\004\022\016\n\nOVERLOADED\020\005\022\025\n\021"
+  "DEADLINE_EXCEEDED\020\006\022\025\n\021APPLICATION_ERROR"
+  "\020\007b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_rpcheader_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_rpcheader_2eproto = {
-    false, false, 111, descriptor_table_protodef_rpcheader_2eproto,
+    false, false, 650, descriptor_table_protodef_rpcheader_2eproto,
     "rpcheader.proto",
-    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 1,
+    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 2,
     schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
     file_level_metadata_rpcheader_2eproto, file_level_enum_descriptors_rpcheader_2eproto,
     file_level_service_descriptors_rpcheader_2eproto,
@@ -80,6 +137,42 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcheade
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcheader_2eproto(&descriptor_table_rpcheader_2eproto);
 namespace rpcheader {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Priority_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcheader_2eproto);
+  return file_level_enum_descriptors_rpcheader_2eproto[0];
+}
+bool Priority_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcheader_2eproto);
+  return file_level_enum_descriptors_rpcheader_2eproto[1];
+}
+bool StatusCode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -90,42 +183,83 @@ class rpcheader::_Internal {
 rpcheader::rpcheader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:rpcheader.rpcheader)
 }
 rpcheader::rpcheader(const rpcheader& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  rpcheader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.args_size_){}
+    , decltype(_impl_.method_id_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.cancel_){}
+    , decltype(_impl_.priority_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  service_name_.InitDefault();
+  _impl_.service_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    service_name_.Set("", GetArenaForAllocation());
+    _impl_.service_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_service_name().empty()) {
-    service_name_.Set(from._internal_service_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
   }
-  method_name_.InitDefault();
+  _impl_.method_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    method_name_.Set("", GetArenaForAllocation());
+    _impl_.method_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_method_name().empty()) {
-    method_name_.Set(from._internal_method_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
   }
-  args_size_ = from.args_size_;
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant().empty()) {
+    _this->_impl_.tenant_.Set(from._internal_tenant(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.priority_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.priority_));
   // @@protoc_insertion_point(copy_constructor:rpcheader.rpcheader)
 }
 
-inline void rpcheader::SharedCtor() {
-service_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  service_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-method_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  method_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-args_size_ = 0u;
+inline void rpcheader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.args_size_){0u}
+    , decltype(_impl_.method_id_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.cancel_){false}
+    , decltype(_impl_.priority_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 rpcheader::~rpcheader() {
@@ -139,12 +273,13 @@ rpcheader::~rpcheader() {
 
 inline void rpcheader::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  service_name_.Destroy();
-  method_name_.Destroy();
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
+  _impl_.tenant_.Destroy();
 }
 
 void rpcheader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void rpcheader::Clear() {
@@ -153,9 +288,12 @@ void rpcheader::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  service_name_.ClearToEmpty();
-  method_name_.ClearToEmpty();
-  args_size_ = 0u;
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  _impl_.tenant_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.priority_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.priority_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -186,7 +324,57 @@ const char* rpcheader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
       // uint32 args_size = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.args_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 method_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cancel = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.cancel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.Priority priority = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_priority(static_cast<::rpcheader::Priority>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes tenant = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_tenant();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -238,6 +426,43 @@ uint8_t* rpcheader::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_args_size(), target);
   }
 
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_request_id(), target);
+  }
+
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_method_id(), target);
+  }
+
+  // uint32 timeout_ms = 6;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_timeout_ms(), target);
+  }
+
+  // bool cancel = 7;
+  if (this->_internal_cancel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_cancel(), target);
+  }
+
+  // .rpcheader.Priority priority = 8;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_priority(), target);
+  }
+
+  // bytes tenant = 9;
+  if (!this->_internal_tenant().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_tenant(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -268,43 +493,90 @@ size_t rpcheader::ByteSizeLong() const {
         this->_internal_method_name());
   }
 
+  // bytes tenant = 9;
+  if (!this->_internal_tenant().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_tenant());
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
   // uint32 args_size = 3;
   if (this->_internal_args_size() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_args_size());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_id());
+  }
+
+  // uint32 timeout_ms = 6;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // bool cancel = 7;
+  if (this->_internal_cancel() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .rpcheader.Priority priority = 8;
+  if (this->_internal_priority() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_priority());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData rpcheader::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     rpcheader::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*rpcheader::GetClassData() const { return &_class_data_; }
 
-void rpcheader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<rpcheader *>(to)->MergeFrom(
-      static_cast<const rpcheader &>(from));
-}
 
-
-void rpcheader::MergeFrom(const rpcheader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.rpcheader)
-  GOOGLE_DCHECK_NE(&from, this);
+void rpcheader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<rpcheader*>(&to_msg);
+  auto& from = static_cast<const rpcheader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.rpcheader)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_service_name().empty()) {
-    _internal_set_service_name(from._internal_service_name());
+    _this->_internal_set_service_name(from._internal_service_name());
   }
   if (!from._internal_method_name().empty()) {
-    _internal_set_method_name(from._internal_method_name());
+    _this->_internal_set_method_name(from._internal_method_name());
+  }
+  if (!from._internal_tenant().empty()) {
+    _this->_internal_set_tenant(from._internal_tenant());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
   if (from._internal_args_size() != 0) {
-    _internal_set_args_size(from._internal_args_size());
+    _this->_internal_set_args_size(from._internal_args_size());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_cancel() != 0) {
+    _this->_internal_set_cancel(from._internal_cancel());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void rpcheader::CopyFrom(const rpcheader& from) {
@@ -324,14 +596,23 @@ void rpcheader::InternalSwap(rpcheader* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &service_name_, lhs_arena,
-      &other->service_name_, rhs_arena
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &method_name_, lhs_arena,
-      &other->method_name_, rhs_arena
+      &_impl_.tenant_, lhs_arena,
+      &other->_impl_.tenant_, rhs_arena
   );
-  swap(args_size_, other->args_size_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(rpcheader, _impl_.priority_)
+      + sizeof(rpcheader::_impl_.priority_)
+      - PROTOBUF_FIELD_OFFSET(rpcheader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata rpcheader::GetMetadata() const {
@@ -340,6 +621,315 @@ void rpcheader::InternalSwap(rpcheader* other) {
       file_level_metadata_rpcheader_2eproto[0]);
 }
 
+// ===================================================================
+
+class rpcresponseheader::_Internal {
+ public:
+};
+
+rpcresponseheader::rpcresponseheader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:rpcheader.rpcresponseheader)
+}
+rpcresponseheader::rpcresponseheader(const rpcresponseheader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  rpcresponseheader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.response_size_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.method_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.response_size_, &from._impl_.response_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.method_id_) -
+    reinterpret_cast<char*>(&_impl_.response_size_)) + sizeof(_impl_.method_id_));
+  // @@protoc_insertion_point(copy_constructor:rpcheader.rpcresponseheader)
+}
+
+inline void rpcresponseheader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.response_size_){0u}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.method_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+rpcresponseheader::~rpcresponseheader() {
+  // @@protoc_insertion_point(destructor:rpcheader.rpcresponseheader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void rpcresponseheader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_text_.Destroy();
+}
+
+void rpcresponseheader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void rpcresponseheader::Clear() {
+// @@protoc_insertion_point(message_clear_start:rpcheader.rpcresponseheader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_text_.ClearToEmpty();
+  ::memset(&_impl_.response_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.method_id_) -
+      reinterpret_cast<char*>(&_impl_.response_size_)) + sizeof(_impl_.method_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* rpcresponseheader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 response_size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.response_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .rpcheader.StatusCode status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::rpcheader::StatusCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes error_text = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 method_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* rpcresponseheader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:rpcheader.rpcresponseheader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 response_size = 1;
+  if (this->_internal_response_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_response_size(), target);
+  }
+
+  // .rpcheader.StatusCode status = 2;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_status(), target);
+  }
+
+  // bytes error_text = 3;
+  if (!this->_internal_error_text().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_error_text(), target);
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_request_id(), target);
+  }
+
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_method_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:rpcheader.rpcresponseheader)
+  return target;
+}
+
+size_t rpcresponseheader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:rpcheader.rpcresponseheader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes error_text = 3;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_error_text());
+  }
+
+  // uint32 response_size = 1;
+  if (this->_internal_response_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_size());
+  }
+
+  // .rpcheader.StatusCode status = 2;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint64 request_id = 4;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData rpcresponseheader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    rpcresponseheader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*rpcresponseheader::GetClassData() const { return &_class_data_; }
+
+
+void rpcresponseheader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<rpcresponseheader*>(&to_msg);
+  auto& from = static_cast<const rpcresponseheader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:rpcheader.rpcresponseheader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (from._internal_response_size() != 0) {
+    _this->_internal_set_response_size(from._internal_response_size());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void rpcresponseheader::CopyFrom(const rpcresponseheader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:rpcheader.rpcresponseheader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool rpcresponseheader::IsInitialized() const {
+  return true;
+}
+
+void rpcresponseheader::InternalSwap(rpcresponseheader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(rpcresponseheader, _impl_.method_id_)
+      + sizeof(rpcresponseheader::_impl_.method_id_)
+      - PROTOBUF_FIELD_OFFSET(rpcresponseheader, _impl_.response_size_)>(
+          reinterpret_cast<char*>(&_impl_.response_size_),
+          reinterpret_cast<char*>(&other->_impl_.response_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata rpcresponseheader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[1]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace rpcheader
 PROTOBUF_NAMESPACE_OPEN
@@ -347,6 +937,10 @@ template<> PROTOBUF_NOINLINE ::rpcheader::rpcheader*
 Arena::CreateMaybeMessage< ::rpcheader::rpcheader >(Arena* arena) {
   return Arena::CreateMessageInternal< ::rpcheader::rpcheader >(arena);
 }
+template<> PROTOBUF_NOINLINE ::rpcheader::rpcresponseheader*
+Arena::CreateMaybeMessage< ::rpcheader::rpcresponseheader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::rpcheader::rpcresponseheader >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)